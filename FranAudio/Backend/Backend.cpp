@@ -1,13 +1,19 @@
 // FranticDreamer 2022-2025
 
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
 #include "Backend.hpp"
 #include "miniaudio/Backend_miniaudio.hpp"
 
 #include "FranAudioShared/Logger/Logger.hpp"
+#include "SoundBank/SoundBank.hpp"
 
 FranAudio::Backend::Backend::~Backend()
 {
 	//Shutdown();
+	loaderPool.Stop();
 	DestroyDecoder();
 }
 
@@ -16,6 +22,12 @@ constexpr FranAudio::Backend::BackendType FranAudio::Backend::Backend::GetBacken
 	return BackendType::None;
 }
 
+void FranAudio::Backend::Backend::Update()
+{
+	DropExpiredPendingPlays();
+	PublishDecodedLoads();
+}
+
 // ========================
 // Decoder Management
 // ========================
@@ -37,6 +49,9 @@ void FranAudio::Backend::Backend::SetDecoder(FranAudio::Decoder::DecoderType dec
 		return; // No need to change the decoder
 	}
 
+	// Loader threads might be using the current decoder
+	WaitForPendingLoads();
+
 	if (currentDecoder != nullptr)
 	{
 		currentDecoder->Shutdown();
@@ -67,6 +82,8 @@ void FranAudio::Backend::Backend::SetDecoder(FranAudio::Decoder::DecoderType dec
 
 void FranAudio::Backend::Backend::DestroyDecoder()
 {
+	loaderPool.WaitIdle();
+
 	if (currentDecoder != nullptr)
 	{
 		currentDecoder->Shutdown();
@@ -76,42 +93,1098 @@ void FranAudio::Backend::Backend::DestroyDecoder()
 }
 
 // ========================
-// Sound Management
+// Audio File Management
 // ========================
 
-bool FranAudio::Backend::Backend::IsSoundValid(size_t soundIndex)
+bool FranAudio::Backend::Backend::DecodeToWaveData(const std::string& filename, const AssetLoadOptions& options, FranAudio::Sound::WaveData& targetWaveData)
+{
+	const auto& backendName = FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()];
+	std::filesystem::path filePath(filename);
+	std::error_code errorCode;
+
+	if (!std::filesystem::exists(filePath, errorCode))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: File does not exist: {}", backendName, filename));
+		return false;
+	}
+
+	if (std::filesystem::is_directory(filePath, errorCode))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: File is a directory: {}", backendName, filename));
+		return false;
+	}
+
+	if (std::filesystem::is_empty(filePath, errorCode))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: File is empty: {}", backendName, filename));
+		return false;
+	}
+
+	ResidencyMode residency = options.residency;
+	bool probed = false;
+	if (residency == ResidencyMode::Auto)
+	{
+		uint64_t fileSize = std::filesystem::file_size(filePath, errorCode);
+		if (errorCode)
+		{
+			fileSize = 0;
+		}
+
+		residency = ResidencyMode::Decoded;
+		if (options.streamThreshold > 0)
+		{
+			// Formats only the decoder can read can't be streamed, so they stay decoded
+			probed = ProbeAudioFile(filename, targetWaveData);
+
+			// Decoded audio is never smaller than the file
+			if (probed && (fileSize >= options.streamThreshold || static_cast<uint64_t>(targetWaveData.SizeInFrames()) * targetWaveData.GetFrameSize() >= options.streamThreshold))
+			{
+				residency = ResidencyMode::Streamed;
+			}
+			else if (!probed && fileSize >= options.streamThreshold)
+			{
+				FranAudioShared::Logger::LogWarning(std::format("{}: Audio file can't be streamed, decoding it instead: {}", backendName, filename));
+			}
+		}
+
+		if (residency != ResidencyMode::Streamed && options.compressedThreshold > 0 && fileSize >= options.compressedThreshold)
+		{
+			residency = ResidencyMode::Compressed;
+		}
+	}
+
+	if (residency == ResidencyMode::Streamed)
+	{
+		if (!probed && !ProbeAudioFile(filename, targetWaveData))
+		{
+			FranAudioShared::Logger::LogError(std::format("{}: Audio file can't be streamed, unsupported format: {}", backendName, filename));
+			return false;
+		}
+
+		targetWaveData.SetFilename(filename);
+		targetWaveData.SetStreamed(true);
+
+		// Nothing to hash, streamed files are never shared
+		return true;
+	}
+
+	if (probed)
+	{
+		// Probed for the stream threshold, start over for the decoder
+		targetWaveData = FranAudio::Sound::WaveData();
+	}
+
+	if (residency == ResidencyMode::Compressed)
+	{
+		if (!ReadEncodedAudioFile(filename, targetWaveData))
+		{
+			return false;
+		}
+
+		targetWaveData.ComputeContentHash();
+		return true;
+	}
+
+	if (currentDecoder == nullptr)
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: No decoder to decode audio file: {}", backendName, filename));
+		return false;
+	}
+
+	DecodeSettings settings;
+	if (options.resampleToEngine)
+	{
+		settings = GetOutputSettings();
+	}
+
+	if (diskCache.IsOpen() && diskCache.Load(filename, settings, currentDecoderType, targetWaveData))
+	{
+		targetWaveData.ComputeContentHash();
+		return true;
+	}
+
+	if (!currentDecoder->DecodeAudioFile(filename, settings, targetWaveData, *this))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to decode audio file: {}", backendName, filename));
+		return false;
+	}
+
+	if (diskCache.IsOpen())
+	{
+		diskCache.Store(filename, settings, currentDecoderType, targetWaveData);
+	}
+
+	// Hashed here, so the main thread doesn't pay for it when the load is published
+	targetWaveData.ComputeContentHash();
+
+	return true;
+}
+
+bool FranAudio::Backend::Backend::ReadEncodedAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData)
 {
-	if (soundIndex == SIZE_MAX)
+	const auto& backendName = FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()];
+
+	// Read straight into the samples, the cache entry owns them and counts them towards the memory budget
+	std::error_code errorCode;
+	const auto fileSize = std::filesystem::file_size(filename, errorCode);
+	std::ifstream file(filename, std::ios::binary);
+	if (errorCode || !file)
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to open audio file: {}", backendName, filename));
+		return false;
+	}
+
+	std::vector<uint8_t> fileBytes(static_cast<size_t>(fileSize));
+	if (!file.read(reinterpret_cast<char*>(fileBytes.data()), static_cast<std::streamsize>(fileBytes.size())))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to read audio file: {}", backendName, filename));
+		return false;
+	}
+	targetWaveData.SetSamples(std::move(fileBytes));
+
+	targetWaveData.SetFilename(filename);
+	targetWaveData.SetEncoded(true);
+
+	if (!ProbeEncodedAudio(targetWaveData))
 	{
+		FranAudioShared::Logger::LogError(std::format("{}: Audio file can't be kept compressed, unsupported format: {}", backendName, filename));
 		return false;
 	}
 
-	return activeSounds.contains(soundIndex);
+	return true;
 }
 
-FranAudio::Sound::Sound& FranAudio::Backend::Backend::GetSound(size_t soundID)
+FranAudio::Backend::AssetID FranAudio::Backend::Backend::AddToWaveDataCache(const std::string& filename, FranAudio::Sound::WaveData&& waveData)
 {
-	return activeSounds.at(soundID);
-} 
+	auto it = filenameWaveMap.find(filename);
+	if (it != filenameWaveMap.end())
+	{
+		return MakeAssetID(it->second);
+	}
+
+	// Share the entry of an identical file that's already loaded
+	const uint64_t contentHash = waveData.GetContentHash();
+	if (contentHash != 0)
+	{
+		auto hashIt = contentHashWaveMap.find(contentHash);
+		if (hashIt != contentHashWaveMap.end())
+		{
+			auto& existingEntry = waveDataCache[hashIt->second];
+			if (existingEntry.resident && existingEntry.waveData->HasSameContent(waveData))
+			{
+				existingEntry.aliases.push_back(filename);
+				existingEntry.referenced = true;
+				RegisterWaveDataName(filename, hashIt->second);
+				deduplicatedBytes += waveData.GetSizeInBytes();
+
+				FranAudioShared::Logger::LogMessage(std::format("{}: Audio file {} is identical to {}, sharing its data ({} bytes saved)", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], filename, existingEntry.filename, waveData.GetSizeInBytes()));
+
+				return MakeAssetID(hashIt->second);
+			}
+		}
+	}
+
+	size_t index = SIZE_MAX;
+	if (!freeWaveDataIndices.empty())
+	{
+		index = freeWaveDataIndices.back();
+		freeWaveDataIndices.pop_back();
+	}
+	else
+	{
+		waveDataCache.emplace_back();
+		index = waveDataCache.size() - 1;
+	}
 
-const FranAudioShared::Containers::UnorderedMap<size_t, FranAudio::Sound::Sound>& FranAudio::Backend::Backend::GetActiveSounds() const
+	auto& entry = waveDataCache[index];
+	if (waveData.IsMapped())
+	{
+		entry.waveData = std::make_shared<const FranAudio::Sound::WaveData>(std::move(waveData));
+	}
+	else
+	{
+		// Counted until the data is actually freed, voices might keep it after the entry is released
+		residentBytes += waveData.GetSizeInBytes();
+		entry.waveData = FranAudio::Sound::WaveDataPtr(new FranAudio::Sound::WaveData(std::move(waveData)), [this](const FranAudio::Sound::WaveData* freedWaveData)
+		{
+			residentBytes -= freedWaveData->GetSizeInBytes();
+			delete freedWaveData;
+		});
+	}
+	entry.filename = filename;
+	entry.referenced = true;
+	entry.resident = true;
+
+	auto limitIt = assetInstanceLimits.find(filename);
+	entry.instanceLimit = limitIt != assetInstanceLimits.end() ? limitIt->second : InstanceLimit();
+	auto groupIt = assetInstanceGroups.find(filename);
+	entry.instanceGroup = groupIt != assetInstanceGroups.end() ? groupIt->second : SIZE_MAX;
+
+	RegisterWaveDataName(filename, index);
+	if (contentHash != 0)
+	{
+		contentHashWaveMap[contentHash] = index;
+	}
+	EnforceMemoryBudget(index);
+
+	return MakeAssetID(index);
+}
+
+void FranAudio::Backend::Backend::RegisterWaveDataName(const std::string& filename, size_t index)
 {
-	return activeSounds;
+	filenameWaveMap[filename] = index;
+
+	const uint64_t nameHash = FranAudio::SoundBank::HashName(filename);
+	if (!nameHashWaveMap.try_emplace(nameHash, index).second)
+	{
+		FranAudioShared::Logger::LogWarning(std::format("{}: Name hash of {} collides with another loaded file, it can't be found by its hash", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], filename));
+	}
 }
 
-const std::vector<size_t> FranAudio::Backend::Backend::GetActiveSoundIDs() const
+void FranAudio::Backend::Backend::UnregisterWaveDataName(const std::string& filename)
 {
-	// No need to reallocate every time
-	static std::vector<size_t> soundIDs;
+	auto it = filenameWaveMap.find(filename);
+	if (it == filenameWaveMap.end())
+	{
+		return;
+	}
 
-	soundIDs.clear();
-	soundIDs.reserve(activeSounds.size());
+	auto hashIt = nameHashWaveMap.find(FranAudio::SoundBank::HashName(filename));
+	if (hashIt != nameHashWaveMap.end() && hashIt->second == it->second)
+	{
+		nameHashWaveMap.erase(hashIt);
+	}
+
+	filenameWaveMap.erase(it);
+}
+
+void FranAudio::Backend::Backend::ReleaseWaveCacheEntry(size_t index)
+{
+	auto& entry = waveDataCache[index];
 
-	for (const auto& [soundID, sound] : activeSounds)
+	UnregisterWaveDataName(entry.filename);
+	for (const auto& alias : entry.aliases)
 	{
-		soundIDs.push_back(soundID);
+		UnregisterWaveDataName(alias);
+	}
+	deduplicatedBytes -= entry.aliases.size() * entry.waveData->GetSizeInBytes();
+
+	auto hashIt = contentHashWaveMap.find(entry.waveData->GetContentHash());
+	if (hashIt != contentHashWaveMap.end() && hashIt->second == index)
+	{
+		contentHashWaveMap.erase(hashIt);
+	}
+
+	// Voices keep their own references, data is freed with the last one
+	entry.waveData.reset();
+	entry.filename.clear();
+	entry.aliases.clear();
+	entry.referenced = false;
+	entry.resident = false;
+	entry.generation++;
+
+	freeWaveDataIndices.push_back(index);
+}
+
+void FranAudio::Backend::Backend::EnforceMemoryBudget(size_t keepIndex)
+{
+	if (memoryBudget == 0 || residentBytes <= memoryBudget || waveDataCache.empty())
+	{
+		return;
+	}
+
+	// CLOCK sweep. Two full turns are enough to clear every reference bit and come back.
+	const size_t maxSteps = waveDataCache.size() * 2;
+	for (size_t step = 0; step < maxSteps && residentBytes > memoryBudget; step++)
+	{
+		const size_t index = evictionHand;
+		evictionHand = (evictionHand + 1) % waveDataCache.size();
+
+		auto& entry = waveDataCache[index];
+		// Mapped entries don't free anything, the OS pages them out on its own.
+		// Streamed entries hold no audio data, evicting them would only make their AssetIDs stale.
+		if (!entry.resident || entry.waveData.use_count() > 1 || index == keepIndex
+			|| entry.waveData->IsMapped() || entry.waveData->IsStreamed() || entry.waveData->GetSizeInBytes() == 0)
+		{
+			continue;
+		}
+
+		if (entry.referenced)
+		{
+			entry.referenced = false;
+			continue;
+		}
+
+		FranAudioShared::Logger::LogMessage(std::format("{}: Evicting audio file to fit the memory budget: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], entry.filename));
+		ReleaseWaveCacheEntry(index);
+	}
+
+	if (residentBytes > memoryBudget)
+	{
+		FranAudioShared::Logger::LogWarning(std::format("{}: Resident audio data ({} bytes) exceeds the memory budget ({} bytes), every other file is being played", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], residentBytes.load(), memoryBudget));
+	}
+}
+
+FranAudio::Sound::WaveDataPtr FranAudio::Backend::Backend::AcquireWaveData(AssetID assetID)
+{
+	const size_t index = GetCacheIndex(assetID);
+	if (index == SIZE_MAX)
+	{
+		return nullptr;
+	}
+
+	auto& entry = waveDataCache[index];
+	entry.referenced = true;
+
+	return entry.waveData;
+}
+
+FranAudio::Backend::AssetID FranAudio::Backend::Backend::MakeAssetID(size_t index) const
+{
+	return FranAudioShared::Containers::MakeSlotHandle(index, waveDataCache[index].generation);
+}
+
+size_t FranAudio::Backend::Backend::GetCacheIndex(AssetID assetID) const
+{
+	const size_t index = FranAudioShared::Containers::GetSlotIndex(assetID);
+	if (index >= waveDataCache.size() || !waveDataCache[index].resident || waveDataCache[index].generation != FranAudioShared::Containers::GetSlotGeneration(assetID))
+	{
+		return SIZE_MAX;
+	}
+
+	return index;
+}
+
+void FranAudio::Backend::Backend::SetAssetLoadOptions(const std::string& filename, const AssetLoadOptions& options)
+{
+	assetLoadOptions[filename] = options;
+}
+
+void FranAudio::Backend::Backend::ClearAssetLoadOptions(const std::string& filename)
+{
+	assetLoadOptions.erase(filename);
+}
+
+FranAudio::Backend::AssetLoadOptions FranAudio::Backend::Backend::GetAssetLoadOptions(const std::string& filename) const
+{
+	auto it = assetLoadOptions.find(filename);
+	if (it != assetLoadOptions.end())
+	{
+		return it->second;
+	}
+
+	return defaultLoadOptions;
+}
+
+void FranAudio::Backend::Backend::SetDefaultLoadOptions(const AssetLoadOptions& options)
+{
+	defaultLoadOptions = options;
+}
+
+const FranAudio::Backend::AssetLoadOptions& FranAudio::Backend::Backend::GetDefaultLoadOptions() const
+{
+	return defaultLoadOptions;
+}
+
+bool FranAudio::Backend::Backend::SetDiskCache(const std::string& directory, uint64_t maxBytes)
+{
+	// Loader threads read and write the cache
+	WaitForPendingLoads();
+	return diskCache.Open(directory, maxBytes);
+}
+
+void FranAudio::Backend::Backend::DisableDiskCache()
+{
+	WaitForPendingLoads();
+	diskCache.Close();
+}
+
+bool FranAudio::Backend::Backend::UnloadAudioFile(const std::string& filename)
+{
+	auto it = filenameWaveMap.find(filename);
+	if (it == filenameWaveMap.end())
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Tried to unload an audio file that is not loaded: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], filename));
+		return false;
+	}
+
+	// Other files still share the data, only forget this name
+	auto& entry = waveDataCache[it->second];
+	if (!entry.aliases.empty())
+	{
+		if (entry.filename == filename)
+		{
+			entry.filename = std::move(entry.aliases.back());
+			entry.aliases.pop_back();
+		}
+		else
+		{
+			std::erase(entry.aliases, filename);
+		}
+
+		deduplicatedBytes -= entry.waveData->GetSizeInBytes();
+		UnregisterWaveDataName(filename);
+		return true;
+	}
+
+	const size_t pinCount = GetWaveDataPinCount(MakeAssetID(it->second));
+	if (pinCount > 0)
+	{
+		FranAudioShared::Logger::LogMessage(std::format("{}: Unloaded audio file will be freed after its {} voices are finished: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], pinCount, filename));
+	}
+
+	ReleaseWaveCacheEntry(it->second);
+	return true;
+}
+
+size_t FranAudio::Backend::Backend::UnloadAll()
+{
+	size_t unloadedCount = 0;
+
+	for (size_t index = 0; index < waveDataCache.size(); index++)
+	{
+		if (waveDataCache[index].resident)
+		{
+			ReleaseWaveCacheEntry(index);
+			unloadedCount++;
+		}
+	}
+
+	return unloadedCount;
+}
+
+FranAudio::Sound::WaveDataPtr FranAudio::Backend::Backend::GetWaveData(AssetID assetID) const
+{
+	const size_t index = GetCacheIndex(assetID);
+	if (index == SIZE_MAX)
+	{
+		return nullptr;
 	}
 
+	return waveDataCache[index].waveData;
+}
+
+size_t FranAudio::Backend::Backend::GetWaveDataPinCount(AssetID assetID) const
+{
+	const size_t index = GetCacheIndex(assetID);
+	if (index == SIZE_MAX)
+	{
+		return 0;
+	}
+
+	return static_cast<size_t>(waveDataCache[index].waveData.use_count() - 1);
+}
+
+void FranAudio::Backend::Backend::SetMemoryBudget(size_t budgetBytes)
+{
+	memoryBudget = budgetBytes;
+	EnforceMemoryBudget();
+}
+
+size_t FranAudio::Backend::Backend::GetMemoryBudget() const
+{
+	return memoryBudget;
+}
+
+size_t FranAudio::Backend::Backend::GetResidentBytes() const
+{
+	return residentBytes;
+}
+
+FranAudio::Backend::AssetID FranAudio::Backend::Backend::GetAssetID(std::string_view filename) const
+{
+	auto it = filenameWaveMap.find(filename);
+	if (it == filenameWaveMap.end())
+	{
+		return InvalidAssetID;
+	}
+
+	return MakeAssetID(it->second);
+}
+
+FranAudio::Backend::AssetID FranAudio::Backend::Backend::GetAssetIDByHash(uint64_t nameHash) const
+{
+	auto it = nameHashWaveMap.find(nameHash);
+	if (it == nameHashWaveMap.end())
+	{
+		return InvalidAssetID;
+	}
+
+	return MakeAssetID(it->second);
+}
+
+size_t FranAudio::Backend::Backend::GetDeduplicatedBytes() const
+{
+	return deduplicatedBytes;
+}
+
+FranAudio::Backend::LoadHandle FranAudio::Backend::Backend::LoadAudioFileAsync(const std::string& filename, LoadCallback callback)
+{
+	// Join the load that's already in flight
+	auto loadIt = filenameLoadMap.find(filename);
+	if (loadIt != filenameLoadMap.end())
+	{
+		if (callback)
+		{
+			pendingLoads[loadIt->second]->callbacks.push_back(std::move(callback));
+		}
+		loadHandleOwners[loadIt->second]++;
+		return loadIt->second;
+	}
+
+	auto load = std::make_shared<PendingLoad>();
+	load->handle = nextLoadHandle++;
+	load->filename = filename;
+	load->options = GetAssetLoadOptions(filename);
+
+	if (callback)
+	{
+		load->callbacks.push_back(std::move(callback));
+	}
+
+	pendingLoads[load->handle] = load;
+	filenameLoadMap[filename] = load->handle;
+	loadHandleOwners[load->handle] = 1;
+
+	if (filenameWaveMap.contains(filename))
+	{
+		// Already cached, publish it on the next update without decoding again.
+		load->status = LoadStatus::Decoded;
+		load->alreadyCached = true;
+
+		{
+			std::lock_guard lock(decodedLoadsMutex);
+			decodedLoads.push_back(load);
+		}
+		decodedLoadsCondition.notify_all();
+
+		return load->handle;
+	}
+
+	EnqueueDecode(load);
+
+	return load->handle;
+}
+
+void FranAudio::Backend::Backend::EnqueueDecode(std::shared_ptr<PendingLoad> load)
+{
+	loaderPool.Enqueue([this, load]()
+	{
+		load->status = LoadStatus::Decoding;
+		const bool result = DecodeToWaveData(load->filename, load->options, load->waveData);
+		load->status = result ? LoadStatus::Decoded : LoadStatus::Failed;
+
+		{
+			std::lock_guard lock(decodedLoadsMutex);
+			decodedLoads.push_back(load);
+		}
+		decodedLoadsCondition.notify_all();
+	});
+}
+
+std::vector<FranAudio::Backend::AssetID> FranAudio::Backend::Backend::LoadAudioFiles(std::span<const std::string> filenames, LoadProgressCallback progressCallback)
+{
+	LoadProgress progress;
+	size_t remainingLoads = 0;
+	std::vector<LoadHandle> ownHandles;
+
+	// Dedupe up front, so every unique file is only queued once
+	FranAudioShared::Containers::UnorderedMap<std::string, uint64_t> uniqueFiles;
+	for (const auto& filename : filenames)
+	{
+		if (filenameWaveMap.contains(filename) || uniqueFiles.contains(filename))
+		{
+			continue;
+		}
+
+		std::error_code errorCode;
+		const auto fileSize = std::filesystem::file_size(filename, errorCode);
+		uniqueFiles[filename] = errorCode ? 0 : static_cast<uint64_t>(fileSize);
+		progress.bytesTotal += uniqueFiles[filename];
+	}
+
+	progress.filesTotal = uniqueFiles.size();
+
+	for (const auto& [filename, fileSize] : uniqueFiles)
+	{
+		const uint64_t bytes = fileSize;
+		const LoadHandle handle = LoadAudioFileAsync(filename, [&progress, &remainingLoads, &progressCallback, bytes](LoadHandle, const std::string&, AssetID assetID)
+		{
+			progress.filesDone++;
+			progress.bytesDone += bytes;
+			if (assetID == InvalidAssetID)
+			{
+				progress.filesFailed++;
+			}
+
+			remainingLoads--;
+
+			if (progressCallback)
+			{
+				progressCallback(progress);
+			}
+		});
+
+		ownHandles.push_back(handle);
+		remainingLoads++;
+	}
+
+	while (remainingLoads > 0)
+	{
+		{
+			std::unique_lock lock(decodedLoadsMutex);
+			decodedLoadsCondition.wait(lock, [this] { return !decodedLoads.empty(); });
+		}
+
+		PublishDecodedLoads();
+	}
+
+	for (const auto handle : ownHandles)
+	{
+		ReleaseLoadHandle(handle);
+	}
+
+	std::vector<AssetID> assetIDs;
+	assetIDs.reserve(filenames.size());
+	for (const auto& filename : filenames)
+	{
+		auto it = filenameWaveMap.find(filename);
+		assetIDs.push_back(it != filenameWaveMap.end() ? MakeAssetID(it->second) : InvalidAssetID);
+	}
+
+	FranAudioShared::Logger::LogMessage(std::format("{}: Batch loaded {} files ({} failed, {} bytes) on {} loader threads, {} bytes deduplicated in total", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], progress.filesDone, progress.filesFailed, progress.bytesDone, loaderPool.GetThreadCount(), deduplicatedBytes));
+
+	return assetIDs;
+}
+
+std::vector<FranAudio::Backend::AssetID> FranAudio::Backend::Backend::LoadAudioManifest(const std::string& manifestFilename, LoadProgressCallback progressCallback)
+{
+	std::ifstream manifest(manifestFilename);
+	if (!manifest.is_open())
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to open manifest file: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], manifestFilename));
+		return {};
+	}
+
+	std::vector<std::string> filenames;
+	std::string line;
+	while (std::getline(manifest, line))
+	{
+		// Trim whitespace and carriage returns
+		const auto first = line.find_first_not_of(" \t\r");
+		if (first == std::string::npos || line[first] == '#')
+		{
+			continue;
+		}
+		const auto last = line.find_last_not_of(" \t\r");
+
+		filenames.push_back(line.substr(first, last - first + 1));
+	}
+
+	return LoadAudioFiles(filenames, std::move(progressCallback));
+}
+
+size_t FranAudio::Backend::Backend::LoadSoundBank(const std::string& bankFilename)
+{
+	const auto& backendName = FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()];
+
+	FranAudio::SoundBank::SoundBank bank;
+	if (!bank.Open(bankFilename))
+	{
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to load sound bank: {}", backendName, bankFilename));
+		return SIZE_MAX;
+	}
+
+	size_t registeredCount = 0;
+	for (size_t i = 0; i < bank.GetEntryCount(); i++)
+	{
+		const std::string name(bank.GetEntryName(i));
+		if (filenameWaveMap.contains(name))
+		{
+			continue;
+		}
+
+		FranAudio::Sound::WaveData waveData;
+		if (!bank.GetWaveData(i, waveData))
+		{
+			continue;
+		}
+
+		AddToWaveDataCache(name, std::move(waveData));
+		registeredCount++;
+	}
+
+	FranAudioShared::Logger::LogSuccess(std::format("{}: Loaded {} of {} entries from sound bank: {}", backendName, registeredCount, bank.GetEntryCount(), bankFilename));
+
+	return registeredCount;
+}
+
+FranAudio::Backend::LoadStatus FranAudio::Backend::Backend::GetLoadStatus(LoadHandle handle)
+{
+	auto pendingIt = pendingLoads.find(handle);
+	if (pendingIt != pendingLoads.end())
+	{
+		return pendingIt->second->status;
+	}
+
+	auto finishedIt = finishedLoads.find(handle);
+	if (finishedIt != finishedLoads.end())
+	{
+		return finishedIt->second.status;
+	}
+
+	return LoadStatus::Invalid;
+}
+
+FranAudio::Backend::AssetID FranAudio::Backend::Backend::GetLoadResult(LoadHandle handle) const
+{
+	auto it = finishedLoads.find(handle);
+	if (it == finishedLoads.end())
+	{
+		return InvalidAssetID;
+	}
+
+	return it->second.assetID;
+}
+
+void FranAudio::Backend::Backend::ReleaseLoadHandle(LoadHandle handle)
+{
+	auto it = loadHandleOwners.find(handle);
+	if (it == loadHandleOwners.end())
+	{
+		return;
+	}
+
+	if (--it->second == 0)
+	{
+		loadHandleOwners.erase(it);
+		finishedLoads.erase(handle);
+	}
+}
+
+void FranAudio::Backend::Backend::WaitForPendingLoads()
+{
+	// Publishing decodes a cached file again if it was unloaded since it was queued
+	while (!pendingLoads.empty())
+	{
+		loaderPool.WaitIdle();
+		PublishDecodedLoads();
+	}
+}
+
+void FranAudio::Backend::Backend::SetLoaderThreadCount(size_t threadCount)
+{
+	WaitForPendingLoads();
+	loaderPool.Stop();
+	loaderPool.Start(threadCount);
+}
+
+void FranAudio::Backend::Backend::PublishDecodedLoads()
+{
+	std::vector<std::shared_ptr<PendingLoad>> loads;
+
+	{
+		std::lock_guard lock(decodedLoadsMutex);
+		loads.swap(decodedLoads);
+	}
+
+	for (auto& load : loads)
+	{
+		AssetID assetID = InvalidAssetID;
+
+		if (load->alreadyCached)
+		{
+			auto it = filenameWaveMap.find(load->filename);
+			if (it == filenameWaveMap.end())
+			{
+				// Unloaded or evicted since it was queued, it has no wave data to publish
+				load->alreadyCached = false;
+				load->status = LoadStatus::Queued;
+				EnqueueDecode(load);
+				continue;
+			}
+
+			assetID = MakeAssetID(it->second);
+			load->status = LoadStatus::Loaded;
+		}
+		else if (load->status == LoadStatus::Decoded)
+		{
+			assetID = AddToWaveDataCache(load->filename, std::move(load->waveData));
+			load->status = LoadStatus::Loaded;
+
+			FranAudioShared::Logger::LogSuccess(std::format("{}: Loaded audio file asynchronously: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], load->filename));
+		}
+
+		// Nobody can ask for the result if every owner released the handle already
+		if (loadHandleOwners.contains(load->handle))
+		{
+			finishedLoads[load->handle] = { load->status, assetID };
+		}
+		pendingLoads.erase(load->handle);
+		filenameLoadMap.erase(load->filename);
+
+		for (auto& callback : load->callbacks)
+		{
+			callback(load->handle, load->filename, assetID);
+		}
+	}
+}
+
+// ========================
+// Play on Miss
+// ========================
+
+size_t FranAudio::Backend::Backend::PlayAudioFile(const std::string& filename)
+{
+	auto it = filenameWaveMap.find(filename);
+	if (it != filenameWaveMap.end())
+	{
+		return PlayAudioAsset(MakeAssetID(it->second));
+	}
+
+	// Not loaded, reserve the ID and start it once the load is published
+	const size_t soundID = activeSounds.ReserveHandle();
+	pendingPlays[soundID].requestTime = std::chrono::steady_clock::now();
+
+	// Owners are counted, so releasing doesn't take the result away from others that joined the load
+	LoadAudioFileAsync(filename, [this, soundID](LoadHandle handle, const std::string& loadedFilename, AssetID assetID)
+	{
+		ReleaseLoadHandle(handle);
+
+		StartPendingPlay(soundID, loadedFilename, assetID);
+	});
+
+	return soundID;
+}
+
+bool FranAudio::Backend::Backend::IsSoundPending(size_t soundID) const
+{
+	return pendingPlays.contains(soundID);
+}
+
+bool FranAudio::Backend::Backend::CancelPendingPlay(size_t soundID)
+{
+	if (pendingPlays.erase(soundID) == 0)
+	{
+		return false;
+	}
+
+	activeSounds.Erase(soundID);
+	return true;
+}
+
+void FranAudio::Backend::Backend::SetMaxPlayLatency(std::chrono::milliseconds latency)
+{
+	maxPlayLatency = latency;
+}
+
+std::chrono::milliseconds FranAudio::Backend::Backend::GetMaxPlayLatency() const
+{
+	return maxPlayLatency;
+}
+
+FranAudio::Backend::Backend::PendingPlay* FranAudio::Backend::Backend::FindPendingPlay(size_t soundID)
+{
+	auto it = pendingPlays.find(soundID);
+	if (it == pendingPlays.end())
+	{
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
+void FranAudio::Backend::Backend::StartPendingPlay(size_t soundID, const std::string& filename, AssetID assetID)
+{
+	auto it = pendingPlays.find(soundID);
+	if (it == pendingPlays.end())
+	{
+		// Cancelled or dropped
+		return;
+	}
+
+	const PendingPlay pending = it->second;
+	pendingPlays.erase(it);
+
+	if (assetID == InvalidAssetID)
+	{
+		activeSounds.Erase(soundID);
+		FranAudioShared::Logger::LogError(std::format("{}: Failed to load audio file for playing: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], filename));
+		return;
+	}
+
+	const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - pending.requestTime);
+	if (maxPlayLatency.count() > 0 && waited > maxPlayLatency)
+	{
+		activeSounds.Erase(soundID);
+		FranAudioShared::Logger::LogWarning(std::format("{}: Dropped sound {}, loading took {} ms: {}", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], soundID, waited.count(), filename));
+		return;
+	}
+
+	if (!StartSound(soundID, assetID))
+	{
+		activeSounds.Erase(soundID);
+		return;
+	}
+
+	if (pending.volume != 1.0f)
+	{
+		SetSoundVolume(soundID, pending.volume);
+	}
+
+	if (pending.hasPosition)
+	{
+		SetSoundPosition(soundID, pending.position);
+	}
+
+	if (pending.startSeconds > 0.0)
+	{
+		SeekSound(soundID, pending.startSeconds);
+	}
+
+	if (pending.priority != 1.0f)
+	{
+		SetSoundPriority(soundID, pending.priority);
+	}
+}
+
+void FranAudio::Backend::Backend::DropExpiredPendingPlays()
+{
+	if (maxPlayLatency.count() <= 0 || pendingPlays.empty())
+	{
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+
+	std::vector<size_t> expiredSounds;
+	for (const auto& [soundID, pending] : pendingPlays)
+	{
+		if (now - pending.requestTime > maxPlayLatency)
+		{
+			expiredSounds.push_back(soundID);
+		}
+	}
+
+	for (size_t soundID : expiredSounds)
+	{
+		pendingPlays.erase(soundID);
+		activeSounds.Erase(soundID);
+		FranAudioShared::Logger::LogWarning(std::format("{}: Dropped sound {}, its audio file is still loading", FranAudio::Backend::BackendTypeViews[(size_t)GetBackendType()], soundID));
+	}
+}
+
+// ========================
+// Streaming
+// ========================
+
+void FranAudio::Backend::Backend::SetStreamingSettings(const StreamingSettings& settings)
+{
+	streamingSettings = settings;
+}
+
+const FranAudio::Backend::StreamingSettings& FranAudio::Backend::Backend::GetStreamingSettings() const
+{
+	return streamingSettings;
+}
+
+// ========================
+// Sound Management
+// ========================
+
+bool FranAudio::Backend::Backend::IsSoundValid(size_t soundIndex)
+{
+	return activeSounds.Contains(soundIndex);
+}
+
+void FranAudio::Backend::Backend::SetMaxRealVoices(size_t maxVoices)
+{
+	maxRealVoices = maxVoices;
+}
+
+size_t FranAudio::Backend::Backend::GetMaxRealVoices() const
+{
+	return maxRealVoices;
+}
+
+void FranAudio::Backend::Backend::SetInstanceLimit(const std::string& filename, const InstanceLimit& limit)
+{
+	assetInstanceLimits[filename] = limit;
+
+	auto it = filenameWaveMap.find(filename);
+	if (it != filenameWaveMap.end())
+	{
+		waveDataCache[it->second].instanceLimit = limit;
+	}
+}
+
+void FranAudio::Backend::Backend::SetInstanceGroup(const std::string& filename, const std::string& group)
+{
+	const size_t groupIndex = group.empty() ? SIZE_MAX : GetInstanceGroupIndex(group);
+	if (groupIndex == SIZE_MAX)
+	{
+		assetInstanceGroups.erase(filename);
+	}
+	else
+	{
+		assetInstanceGroups[filename] = groupIndex;
+	}
+
+	auto it = filenameWaveMap.find(filename);
+	if (it != filenameWaveMap.end())
+	{
+		waveDataCache[it->second].instanceGroup = groupIndex;
+	}
+}
+
+void FranAudio::Backend::Backend::SetGroupInstanceLimit(const std::string& group, const InstanceLimit& limit)
+{
+	instanceGroupLimits[GetInstanceGroupIndex(group)] = limit;
+}
+
+size_t FranAudio::Backend::Backend::GetInstanceGroupIndex(const std::string& group)
+{
+	auto it = instanceGroupIndices.find(group);
+	if (it != instanceGroupIndices.end())
+	{
+		return it->second;
+	}
+
+	const size_t index = instanceGroupLimits.size();
+	instanceGroupLimits.emplace_back();
+	instanceGroupIndices.emplace(group, index);
+	return index;
+}
+
+FranAudio::Sound::Sound& FranAudio::Backend::Backend::GetSound(size_t soundID)
+{
+	auto* sound = activeSounds.Find(soundID);
+	if (!sound)
+	{
+		throw std::out_of_range("Sound ID is not playing: " + std::to_string(soundID));
+	}
+
+	return *sound;
+}
+
+const FranAudioShared::Containers::SlotMap<FranAudio::Sound::Sound>& FranAudio::Backend::Backend::GetActiveSounds() const
+{
+	return activeSounds;
+}
+
+const std::vector<size_t> FranAudio::Backend::Backend::GetActiveSoundIDs() const
+{
+	// No need to reallocate every time
+	static std::vector<size_t> soundIDs;
+
+	soundIDs.clear();
+	soundIDs.reserve(activeSounds.Size());
+
+	activeSounds.ForEach([](size_t soundID, const FranAudio::Sound::Sound&)
+	{
+		soundIDs.push_back(soundID);
+	});
+
 	return soundIDs;
 }
 
@@ -3,11 +3,21 @@
 
 #include <string>
 #include <vector>
+#include <span>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 #include "Backend/BackendTypes.hpp"
 
 #include "FranAudioShared/Containers/UnorderedMap.hpp"
+#include "FranAudioShared/Containers/SegmentedVector.hpp"
+#include "FranAudioShared/Containers/SlotMap.hpp"
+#include "FranAudioShared/Threading/ThreadPool.hpp"
 #include "Decoder/Decoder.hpp"
+#include "SoundBank/DiskCache.hpp"
 #include "Sound/WaveData/WaveData.hpp"
 #include "Sound/Sound.hpp"
 
@@ -23,28 +33,413 @@ namespace FranAudio::Backend
 		FranAudio::Decoder::DecoderType currentDecoderType = FranAudio::Decoder::DecoderType::None;
 
 		/// <summary>
-		/// Next Sound ID to be used.
-		/// This is used to generate unique IDs for sounds.
+		/// An entry of the decoded audio data cache.
 		/// </summary>
-		size_t nextSoundID = 0;
+		struct WaveCacheEntry
+		{
+			/// <summary>
+			/// Cache's reference to the audio data.
+			/// Voices hold their own references, so the use count above 1 is the number of voices pinning it.
+			/// </summary>
+			FranAudio::Sound::WaveDataPtr waveData;
+			std::string filename;
+
+			/// <summary>
+			/// Other files that have the same content, sharing this entry.
+			/// </summary>
+			std::vector<std::string> aliases;
+
+			/// <summary>
+			/// CLOCK reference bit, set every time the entry is played.
+			/// </summary>
+			bool referenced = false;
+
+			/// <summary>
+			/// Is the audio data in memory?
+			/// False for unloaded entries, which are free to be reused.
+			/// </summary>
+			bool resident = false;
+
+			/// <summary>
+			/// Bumped every time the entry is released, so AssetIDs of the released data are rejected.
+			/// </summary>
+			uint32_t generation = 0;
+
+			/// <summary>
+			/// Maximum number of voices of this entry, see SetInstanceLimit.
+			/// </summary>
+			InstanceLimit instanceLimit;
+
+			/// <summary>
+			/// Index of the instance group of this entry, SIZE_MAX if it's not in one. See SetInstanceGroup.
+			/// </summary>
+			size_t instanceGroup = SIZE_MAX;
+		};
+
+		/// <summary>
+		/// Total size of the resident audio data in bytes, including the unloaded data that voices are still playing.
+		/// Decreased by the deleter of the audio data when its last reference is released, which can be any thread.
+		/// Declared before waveDataCache, so it outlives the cache's references.
+		/// </summary>
+		std::atomic<size_t> residentBytes = 0;
 
 		/// <summary>
 		/// Cache for decoded audio data.
 		/// This is used to cache the decoded audio data to avoid decoding every time the audio is played.
+		/// 
+		/// <para>
+		/// Entries never move in memory, so voices can safely read the audio data of an entry
+		/// while new files are being added to the cache.
+		/// </para>
 		/// </summary>
-		std::vector<FranAudio::Sound::WaveData> waveDataCache;
+		FranAudioShared::Containers::SegmentedVector<WaveCacheEntry> waveDataCache;
+
+		/// <summary>
+		/// Indices of unloaded entries in waveDataCache, to be reused by new loads.
+		/// </summary>
+		std::vector<size_t> freeWaveDataIndices;
+
+		/// <summary>
+		/// Maximum size of the resident audio data in bytes.
+		/// 0 means unlimited.
+		/// </summary>
+		size_t memoryBudget = 0;
+
+		/// <summary>
+		/// CLOCK hand for the eviction sweep over waveDataCache.
+		/// </summary>
+		size_t evictionHand = 0;
 
 		/// <summary>
 		/// Map for finding decoded audio data in cache by filename.
 		/// This is used to evade a lookup in the vector.
+		/// Can be searched with string views without allocating.
 		/// </summary>
-		FranAudioShared::Containers::UnorderedMap<std::string, size_t> filenameWaveMap;
+		FranAudioShared::Containers::StringMap<size_t> filenameWaveMap;
+
+		/// <summary>
+		/// Map for finding decoded audio data in cache by the hash of its filename.
+		/// Hashes are SoundBank::HashName, so they can be computed at compile time by the caller.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<uint64_t, size_t> nameHashWaveMap;
+
+		/// <summary>
+		/// Map for finding decoded audio data in cache by its content hash.
+		/// This is used to share one entry between identical files with different names.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<uint64_t, size_t> contentHashWaveMap;
+
+		/// <summary>
+		/// Total size of the audio data that didn't need to be stored again, thanks to content deduplication.
+		/// </summary>
+		size_t deduplicatedBytes = 0;
 
 		/// <summary>
 		/// Currently Active Sounds
-		/// Tied to nextSoundID
+		/// Sound IDs are the handles of this map, so a stopped sound's ID stays invalid even after its slot is reused.
+		/// Pending sounds reserve their handle here, see pendingPlays.
+		/// </summary>
+		FranAudioShared::Containers::SlotMap<FranAudio::Sound::Sound> activeSounds;
+
+		// ========================
+		// Asynchronous Loading
+		// ========================
+
+		/// <summary>
+		/// State of an asynchronous load.
+		/// Shared between the main thread and the loader thread that decodes it.
+		/// </summary>
+		struct PendingLoad
+		{
+			LoadHandle handle = SIZE_MAX;
+			std::string filename;
+			AssetLoadOptions options;
+			std::atomic<LoadStatus> status = LoadStatus::Queued;
+
+			/// <summary>
+			/// Decoded data. Only touched by the loader thread until the status is Decoded.
+			/// </summary>
+			FranAudio::Sound::WaveData waveData;
+
+			/// <summary>
+			/// Was the file already cached when it was queued? Then it has no wave data of its own.
+			/// </summary>
+			bool alreadyCached = false;
+
+			/// <summary>
+			/// Callbacks to run once the load is published. Main thread only.
+			/// </summary>
+			std::vector<LoadCallback> callbacks;
+		};
+
+		/// <summary>
+		/// Result of a finished asynchronous load.
+		/// </summary>
+		struct LoadResult
+		{
+			LoadStatus status = LoadStatus::Invalid;
+			AssetID assetID = InvalidAssetID;
+		};
+
+		/// <summary>
+		/// Worker threads that decode audio files for asynchronous loads.
+		/// </summary>
+		FranAudioShared::Threading::ThreadPool loaderPool;
+
+		/// <summary>
+		/// Next Load Handle to be used.
+		/// </summary>
+		LoadHandle nextLoadHandle = 0;
+
+		/// <summary>
+		/// Loads that are not published yet, by their handle.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<LoadHandle, std::shared_ptr<PendingLoad>> pendingLoads;
+
+		/// <summary>
+		/// Map for finding in-flight loads by filename.
+		/// This is used to avoid decoding the same file twice.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<std::string, LoadHandle> filenameLoadMap;
+
+		/// <summary>
+		/// Results of the published loads, kept until the handle is released.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<LoadHandle, LoadResult> finishedLoads;
+
+		/// <summary>
+		/// Number of unreleased LoadAudioFileAsync calls that returned each handle.
+		/// Joined loads share a handle, so its result is only forgotten once every caller releases it.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<LoadHandle, size_t> loadHandleOwners;
+
+		/// <summary>
+		/// Loads that are finished by the loader threads, waiting to be published by Update().
+		/// Guarded by decodedLoadsMutex, decodedLoadsCondition is notified on every push.
+		/// </summary>
+		std::vector<std::shared_ptr<PendingLoad>> decodedLoads;
+		std::mutex decodedLoadsMutex;
+		std::condition_variable decodedLoadsCondition;
+
+		/// <summary>
+		/// Settings of the streaming workers.
+		/// </summary>
+		StreamingSettings streamingSettings;
+
+		/// <summary>
+		/// Maximum number of sounds that are mixed at once, the least audible ones are virtualised.
+		/// 0 means unlimited.
+		/// </summary>
+		size_t maxRealVoices = 0;
+
+		// ========================
+		// Instance Limits
+		// ========================
+
+		/// <summary>
+		/// Instance limits of the audio files, by filename. Copied into the cache entry when the file is loaded.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<std::string, InstanceLimit> assetInstanceLimits;
+
+		/// <summary>
+		/// Instance groups of the audio files, by filename. Copied into the cache entry when the file is loaded.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<std::string, size_t> assetInstanceGroups;
+
+		/// <summary>
+		/// Indices of the instance groups, by name.
+		/// </summary>
+		FranAudioShared::Containers::StringMap<size_t> instanceGroupIndices;
+
+		/// <summary>
+		/// Instance limits of the groups, by group index.
+		/// </summary>
+		std::vector<InstanceLimit> instanceGroupLimits;
+
+		/// <summary>
+		/// Get the index of an instance group, adding it if it doesn't exist.
+		/// </summary>
+		/// <param name="group">Name of the group</param>
+		/// <returns>Group index</returns>
+		size_t GetInstanceGroupIndex(const std::string& group);
+
+		/// <summary>
+		/// Default options for loading audio files.
 		/// </summary>
-		FranAudioShared::Containers::UnorderedMap<size_t, FranAudio::Sound::Sound> activeSounds;
+		AssetLoadOptions defaultLoadOptions;
+
+		/// <summary>
+		/// Per file options for loading audio files, overriding the defaults.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<std::string, AssetLoadOptions> assetLoadOptions;
+
+		/// <summary>
+		/// Persistent cache of decoded audio files, disabled unless a directory is set.
+		/// </summary>
+		FranAudio::SoundBank::DiskCache diskCache;
+
+		/// <summary>
+		/// Register a filename for a wave data cache entry, in both filename and name hash maps.
+		/// </summary>
+		void RegisterWaveDataName(const std::string& filename, size_t index);
+
+		/// <summary>
+		/// Remove a filename from both filename and name hash maps.
+		/// </summary>
+		void UnregisterWaveDataName(const std::string& filename);
+
+		/// <summary>
+		/// Check the file and decode it with the current decoder, or keep it compressed or streamed depending on the options.
+		/// Safe to call from loader threads.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="options">Load options of the file, see GetAssetLoadOptions</param>
+		/// <param name="targetWaveData">Target WaveData to store the decoded audio</param>
+		/// <returns>True if the file was decoded successfully</returns>
+		bool DecodeToWaveData(const std::string& filename, const AssetLoadOptions& options, FranAudio::Sound::WaveData& targetWaveData);
+
+		/// <summary>
+		/// Read the encoded bytes of an audio file into a WaveData, without decoding it.
+		/// Safe to call from loader threads.
+		/// </summary>
+		/// <param name="filename">Path to an existing audio file</param>
+		/// <param name="targetWaveData">Target WaveData to store the encoded audio</param>
+		/// <returns>True if the file was read and probed successfully</returns>
+		bool ReadEncodedAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData);
+
+		/// <summary>
+		/// Fill the format, channels, sample rate and length of an encoded WaveData from its bytes.
+		/// Safe to call from loader threads.
+		/// </summary>
+		/// <param name="waveData">WaveData that holds the encoded file bytes</param>
+		/// <returns>True if the backend can decode the data</returns>
+		virtual bool ProbeEncodedAudio(FranAudio::Sound::WaveData& waveData) = 0;
+
+		/// <summary>
+		/// Fill the format, channels, sample rate and length of a WaveData from an audio file, without decoding it.
+		/// Used for deciding if a file is streamed, and for describing the streamed files.
+		/// Safe to call from loader threads.
+		/// </summary>
+		/// <param name="filename">Path to an existing audio file</param>
+		/// <param name="waveData">Target WaveData, its samples are left untouched</param>
+		/// <returns>True if the backend can decode the file</returns>
+		virtual bool ProbeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& waveData) = 0;
+
+		/// <summary>
+		/// Move decoded audio data into the cache and map its filename.
+		/// If the filename is already cached, the existing entry is kept.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="waveData">Decoded audio data</param>
+		/// <returns>AssetID of the entry</returns>
+		AssetID AddToWaveDataCache(const std::string& filename, FranAudio::Sound::WaveData&& waveData);
+
+		/// <summary>
+		/// Publish the loads that are finished by the loader threads and run their callbacks.
+		/// </summary>
+		void PublishDecodedLoads();
+
+		/// <summary>
+		/// Decode the file of a load on a loader thread, and queue it for publishing.
+		/// </summary>
+		void EnqueueDecode(std::shared_ptr<PendingLoad> load);
+
+		/// <summary>
+		/// Drop the cache's reference to the audio data of an entry and make its index reusable.
+		/// The data itself is freed when the last voice playing it is finished.
+		/// </summary>
+		/// <param name="index">Wave Data Cache Index</param>
+		void ReleaseWaveCacheEntry(size_t index);
+
+		/// <summary>
+		/// Evict the least recently played entries without voices until the resident data fits the memory budget.
+		/// Entries with voices are skipped, since evicting them wouldn't free any memory.
+		/// </summary>
+		/// <param name="keepIndex">Index that must not be evicted, e.g. the entry that was just loaded</param>
+		void EnforceMemoryBudget(size_t keepIndex = SIZE_MAX);
+
+		// ========================
+		// Play on Miss
+		// ========================
+
+		/// <summary>
+		/// A sound that's waiting for its audio file to be loaded, see PlayAudioFile.
+		/// </summary>
+		struct PendingPlay
+		{
+			std::chrono::steady_clock::time_point requestTime;
+
+			/// <summary>
+			/// Properties that are set before the voice is started, applied once it starts.
+			/// </summary>
+			float volume = 1.0f;
+			float position[3] = { 0.0f, 0.0f, 0.0f };
+			bool hasPosition = false;
+			double startSeconds = 0.0;
+			float priority = 1.0f;
+		};
+
+		/// <summary>
+		/// Sounds that are waiting for their audio files to be loaded, by their Sound ID.
+		/// Their IDs are reserved in activeSounds, but they're not contained until they start.
+		/// </summary>
+		FranAudioShared::Containers::UnorderedMap<size_t, PendingPlay> pendingPlays;
+
+		/// <summary>
+		/// Maximum time between PlayAudioFile and the start of a pending sound.
+		/// Sounds that take longer to load are dropped. 0 means unlimited.
+		/// </summary>
+		std::chrono::milliseconds maxPlayLatency{ 0 };
+
+		/// <summary>
+		/// Get a sound that's waiting for its audio file to be loaded.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayAudioFile</param>
+		/// <returns>Pointer to the pending sound, nullptr if it's not pending</returns>
+		PendingPlay* FindPendingPlay(size_t soundID);
+
+		/// <summary>
+		/// Start a pending sound once its audio file is loaded.
+		/// Does nothing if the sound is cancelled or dropped meanwhile.
+		/// </summary>
+		/// <param name="soundID">Reserved Sound ID</param>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="assetID">AssetID of the loaded file, InvalidAssetID if the load failed</param>
+		void StartPendingPlay(size_t soundID, const std::string& filename, AssetID assetID);
+
+		/// <summary>
+		/// Drop the pending sounds that are waiting longer than maxPlayLatency.
+		/// </summary>
+		void DropExpiredPendingPlays();
+
+		/// <summary>
+		/// Create and start a voice for a loaded audio file with the given Sound ID, and add it to activeSounds.
+		/// </summary>
+		/// <param name="soundID">Sound ID to use, reserved by the caller. The caller erases it if this fails.</param>
+		/// <param name="assetID">AssetID of the loaded file</param>
+		/// <returns>True if the voice is started</returns>
+		virtual bool StartSound(size_t soundID, AssetID assetID) = 0;
+
+		/// <summary>
+		/// Get a reference to the audio data of a cache entry for a new voice, and mark the entry as played.
+		/// The voice must keep the returned handle until it's finished.
+		/// </summary>
+		/// <param name="assetID">AssetID of the entry</param>
+		/// <returns>Handle to the audio data, nullptr if the entry is not resident or the AssetID is stale</returns>
+		FranAudio::Sound::WaveDataPtr AcquireWaveData(AssetID assetID);
+
+		/// <summary>
+		/// Get the AssetID of a resident cache entry, with the entry's current generation.
+		/// </summary>
+		/// <param name="index">Wave Data Cache Index</param>
+		AssetID MakeAssetID(size_t index) const;
+
+		/// <summary>
+		/// Get the cache index of an AssetID.
+		/// </summary>
+		/// <param name="assetID">AssetID of the entry</param>
+		/// <returns>Wave Data Cache Index, SIZE_MAX if the entry is not resident or the AssetID is stale</returns>
+		size_t GetCacheIndex(AssetID assetID) const;
 
 	public:
 		Backend() = default;
@@ -74,6 +469,13 @@ namespace FranAudio::Backend
 		/// <returns>Type of this Backend instance</returns>
 		virtual constexpr BackendType GetBackendType() const noexcept;
 
+		/// <summary>
+		/// Update the backend.
+		/// This should be called regularly from the main thread (e.g. once per frame).
+		/// Publishes finished asynchronous loads and runs their callbacks, which also starts the pending sounds.
+		/// </summary>
+		virtual void Update();
+
 		// ========================
 		// Decoder Management
 		// ========================
@@ -173,6 +575,13 @@ namespace FranAudio::Backend
 		/// </summary>
 		virtual float GetMasterVolume() = 0; // Not const because some audio backends might require non-const pointer.
 
+		/// <summary>
+		/// Get the layout the backend mixes and outputs audio in.
+		/// Used for converting audio files at load time, see AssetLoadOptions::resampleToEngine.
+		/// </summary>
+		/// <returns>Output sample rate and channel count, 0 if unknown</returns>
+		virtual DecodeSettings GetOutputSettings() = 0;
+
 		// ========================
 		// Audio File Management
 		// ========================
@@ -181,16 +590,231 @@ namespace FranAudio::Backend
 		/// Decode an audio file and load it into the memory.
 		/// </summary>
 		/// <param name="filename">Path to the audio file</param>
-		/// <returns>Wave Data Cache Index</returns>
-		virtual size_t LoadAudioFile(const std::string& filename) = 0;
+		/// <returns>AssetID of the file, InvalidAssetID if it can't be loaded</returns>
+		virtual AssetID LoadAudioFile(const std::string& filename) = 0;
+
+		/// <summary>
+		/// Decode an audio file on a loader thread without blocking the caller.
+		/// 
+		/// <para>
+		/// The decoded data is published into the cache on the next Update() after decoding finishes.
+		/// If the file is already loaded or being loaded, no decoding is done again.
+		/// Loads of the same file share their handle, and every call must be paired with a ReleaseLoadHandle.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="callback">Optional callback to run when the load is published</param>
+		/// <returns>Load Handle</returns>
+		LoadHandle LoadAudioFileAsync(const std::string& filename, LoadCallback callback = nullptr);
+
+		/// <summary>
+		/// Decode a batch of audio files in parallel and load them into the memory.
+		/// Blocks until the whole batch is loaded.
+		/// 
+		/// <para>
+		/// Repeated filenames and the files that are already loaded or being loaded are only decoded once.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="filenames">Paths to the audio files</param>
+		/// <param name="progressCallback">Optional callback to report the batch progress</param>
+		/// <returns>AssetIDs, in the same order as filenames. InvalidAssetID for failed files.</returns>
+		std::vector<AssetID> LoadAudioFiles(std::span<const std::string> filenames, LoadProgressCallback progressCallback = nullptr);
+
+		/// <summary>
+		/// Load every audio file listed in a manifest file, see LoadAudioFiles.
+		/// 
+		/// <para>
+		/// Manifest is a text file with one path per line.
+		/// Empty lines and lines starting with '#' are ignored.
+		/// Paths are relative to the working directory, same as LoadAudioFile.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="manifestFilename">Path to the manifest file</param>
+		/// <param name="progressCallback">Optional callback to report the batch progress</param>
+		/// <returns>AssetIDs, in the same order as the manifest entries</returns>
+		std::vector<AssetID> LoadAudioManifest(const std::string& manifestFilename, LoadProgressCallback progressCallback = nullptr);
+
+		/// <summary>
+		/// Map a baked sound bank and register every entry in it, without decoding anything.
+		/// Entries are played with their names, which are the filenames they were built from.
+		/// 
+		/// <para>
+		/// Entries are read from the mapped file, so they don't count towards the memory budget
+		/// and are never evicted. Unload them with UnloadAudioFile.
+		/// Entries that are already loaded are skipped.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="bankFilename">Path to the sound bank, built with FranAudioBankBuilder</param>
+		/// <returns>Number of entries registered, SIZE_MAX if the bank can't be opened</returns>
+		size_t LoadSoundBank(const std::string& bankFilename);
+
+		/// <summary>
+		/// Get the status of an asynchronous load.
+		/// </summary>
+		/// <param name="handle">Handle returned by LoadAudioFileAsync</param>
+		/// <returns>Status of the load</returns>
+		LoadStatus GetLoadStatus(LoadHandle handle);
+
+		/// <summary>
+		/// Get the result of an asynchronous load.
+		/// </summary>
+		/// <param name="handle">Handle returned by LoadAudioFileAsync</param>
+		/// <returns>AssetID of the file, InvalidAssetID if the load is not published yet or failed</returns>
+		AssetID GetLoadResult(LoadHandle handle) const;
+
+		/// <summary>
+		/// Release a handle returned by LoadAudioFileAsync.
+		/// The result is forgotten once every call that returned the handle is released.
+		/// The loaded audio data stays in the cache.
+		/// </summary>
+		/// <param name="handle">Handle returned by LoadAudioFileAsync</param>
+		void ReleaseLoadHandle(LoadHandle handle);
+
+		/// <summary>
+		/// Block until every asynchronous load is decoded, then publish them.
+		/// </summary>
+		void WaitForPendingLoads();
+
+		/// <summary>
+		/// Set the number of loader threads.
+		/// Waits for the pending loads before restarting the loader threads.
+		/// </summary>
+		/// <param name="threadCount">Number of loader threads. 0 means one per hardware thread.</param>
+		void SetLoaderThreadCount(size_t threadCount);
+
+		/// <summary>
+		/// Set the options for loading a specific audio file.
+		/// Only affects the loads that are started after this call.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="options">Options to use instead of the defaults</param>
+		void SetAssetLoadOptions(const std::string& filename, const AssetLoadOptions& options);
+
+		/// <summary>
+		/// Remove the options of a specific audio file, so it uses the defaults again.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		void ClearAssetLoadOptions(const std::string& filename);
+
+		/// <summary>
+		/// Get the options that will be used for loading an audio file.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>Options of the file if set, the defaults otherwise</returns>
+		AssetLoadOptions GetAssetLoadOptions(const std::string& filename) const;
+
+		/// <summary>
+		/// Set the options for loading the audio files that don't have their own options.
+		/// </summary>
+		/// <param name="options">Default options</param>
+		void SetDefaultLoadOptions(const AssetLoadOptions& options);
+
+		/// <summary>
+		/// Get the options for loading the audio files that don't have their own options.
+		/// </summary>
+		/// <returns>Default options</returns>
+		const AssetLoadOptions& GetDefaultLoadOptions() const;
+
+		/// <summary>
+		/// Enable the persistent on-disk cache of decoded audio files.
+		/// 
+		/// <para>
+		/// Decoded files are written to the directory, and loaded from there on later runs
+		/// as long as the file, its decoder and its load options don't change.
+		/// Cached files are memory-mapped like sound bank entries, so they don't count towards the memory budget.
+		/// Compressed files are not cached.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="directory">Path to the cache directory, created if it doesn't exist</param>
+		/// <param name="maxBytes">Size limit of the directory, least recently used files are removed over it. 0 means unlimited.</param>
+		/// <returns>True if the cache is enabled</returns>
+		bool SetDiskCache(const std::string& directory, uint64_t maxBytes);
+
+		/// <summary>
+		/// Disable the persistent on-disk cache. Cached files are kept on disk.
+		/// </summary>
+		void DisableDiskCache();
+
+		/// <summary>
+		/// Remove a loaded audio file from the memory.
+		/// Voices that are still playing the file keep playing, its data is freed when they're finished.
+		/// 
+		/// <para>
+		/// NOTE: AssetID of the unloaded file becomes invalid, even though its cache index may be reused by the next load.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>True if the file was unloaded</returns>
+		bool UnloadAudioFile(const std::string& filename);
+
+		/// <summary>
+		/// Remove every loaded audio file from the memory.
+		/// Voices that are still playing keep playing, see UnloadAudioFile.
+		/// </summary>
+		/// <returns>Number of unloaded files</returns>
+		size_t UnloadAll();
+
+		/// <summary>
+		/// Get the audio data of a loaded audio file.
+		/// The returned handle keeps the data alive, even if the file is unloaded.
+		/// </summary>
+		/// <param name="assetID">AssetID of the file</param>
+		/// <returns>Handle to the audio data, nullptr if the file is not loaded</returns>
+		FranAudio::Sound::WaveDataPtr GetWaveData(AssetID assetID) const;
+
+		/// <summary>
+		/// Get the number of handles pinning a loaded audio file, excluding the cache itself.
+		/// This is the number of voices that are playing it, plus the handles held by the user.
+		/// </summary>
+		/// <param name="assetID">AssetID of the file</param>
+		/// <returns>Number of pins, 0 if the file is not loaded</returns>
+		size_t GetWaveDataPinCount(AssetID assetID) const;
+
+		/// <summary>
+		/// Set the maximum size of the decoded audio data that's kept in the memory.
+		/// When a load exceeds the budget, least recently played files without voices are unloaded.
+		/// </summary>
+		/// <param name="budgetBytes">Budget in bytes, 0 means unlimited</param>
+		void SetMemoryBudget(size_t budgetBytes);
+
+		/// <summary>
+		/// Get the maximum size of the decoded audio data that's kept in the memory.
+		/// </summary>
+		/// <returns>Budget in bytes, 0 means unlimited</returns>
+		size_t GetMemoryBudget() const;
+
+		/// <summary>
+		/// Get the size of the decoded audio data that's currently in the memory.
+		/// </summary>
+		/// <returns>Resident size in bytes</returns>
+		size_t GetResidentBytes() const;
+
+		/// <summary>
+		/// Get the size of the audio data that's shared between identical files instead of being stored again.
+		/// </summary>
+		/// <returns>Saved size in bytes</returns>
+		size_t GetDeduplicatedBytes() const;
 
 		/// <summary>
 		/// Play an audio file after checking if it's loaded.
-		/// If the audio file is not loaded, it will be loaded and then played.
+		/// 
+		/// <para>
+		/// If the audio file is not loaded, it's loaded on a loader thread without blocking the caller,
+		/// and the sound starts on the Update() that publishes the load.
+		/// The returned ID is valid immediately; volume and position set meanwhile are applied when it starts.
+		/// See SetMaxPlayLatency for dropping the sounds that take too long to load.
+		/// </para>
+		/// 
 		/// </summary>
 		/// <param name="filename">Path to the audio file</param>
 		/// <returns>Active Sounds List Index</returns>
-		virtual size_t PlayAudioFile(const std::string& filename) = 0;
+		virtual size_t PlayAudioFile(const std::string& filename);
 
 		/// <summary>
 		/// Play an audio file without checking if it's loaded.
@@ -200,6 +824,57 @@ namespace FranAudio::Backend
 		/// <returns>Active Sounds List Index</returns>
 		virtual size_t PlayAudioFileNoChecks(const std::string& filename) = 0;
 
+		/// <summary>
+		/// Get the AssetID of a loaded audio file.
+		/// Doesn't allocate, so it's fine to call with string literals.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>AssetID of the file, InvalidAssetID if it's not loaded</returns>
+		AssetID GetAssetID(std::string_view filename) const;
+
+		/// <summary>
+		/// Get the AssetID of a loaded audio file by the hash of its path.
+		/// </summary>
+		/// <param name="nameHash">SoundBank::HashName of the path, can be computed at compile time</param>
+		/// <returns>AssetID of the file, InvalidAssetID if it's not loaded</returns>
+		AssetID GetAssetIDByHash(uint64_t nameHash) const;
+
+		/// <summary>
+		/// Play a loaded audio file by its AssetID.
+		/// This is the fastest way to play a sound, no strings are hashed or compared.
+		/// </summary>
+		/// <param name="assetID">AssetID returned by LoadAudioFile or GetAssetID</param>
+		/// <returns>Active Sounds List Index</returns>
+		virtual size_t PlayAudioAsset(AssetID assetID) = 0;
+
+		/// <summary>
+		/// Check if a sound is waiting for its audio file to be loaded, see PlayAudioFile.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayAudioFile</param>
+		/// <returns>True if the sound is not started yet</returns>
+		bool IsSoundPending(size_t soundID) const;
+
+		/// <summary>
+		/// Cancel a sound that's waiting for its audio file to be loaded.
+		/// The file is still loaded into the cache.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayAudioFile</param>
+		/// <returns>True if the sound was pending</returns>
+		bool CancelPendingPlay(size_t soundID);
+
+		/// <summary>
+		/// Set the maximum time a sound played with PlayAudioFile can wait for its audio file to be loaded.
+		/// Sounds that take longer are dropped instead of starting late.
+		/// </summary>
+		/// <param name="latency">Maximum latency, 0 means unlimited</param>
+		void SetMaxPlayLatency(std::chrono::milliseconds latency);
+
+		/// <summary>
+		/// Get the maximum time a sound played with PlayAudioFile can wait for its audio file to be loaded.
+		/// </summary>
+		/// <returns>Maximum latency, 0 means unlimited</returns>
+		std::chrono::milliseconds GetMaxPlayLatency() const;
+
 		/// <summary>
 		/// Play an audio file without loading it, stream it from the disk.
 		/// This is used to play an audio file without loading it into memory.
@@ -208,6 +883,77 @@ namespace FranAudio::Backend
 		/// <returns>Active Sounds List Index</returns>
 		virtual size_t PlayAudioFileStream(const std::string& filename) = 0;
 
+		/// <summary>
+		/// Keep the start of an audio file decoded in memory, so PlayAudioFileStream can start it
+		/// as fast as a loaded sound. The rest of the file is streamed behind the head as usual.
+		/// Loading the head of a file again replaces it.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="length">Length of the start to keep, it should cover the time it takes to open the file</param>
+		/// <returns>True if the head is loaded</returns>
+		virtual bool LoadStreamHead(const std::string& filename, std::chrono::milliseconds length) = 0;
+
+		/// <summary>
+		/// Remove the decoded start of an audio file from memory.
+		/// Streams that are playing it keep their reference until they're finished.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>True if the file had a head loaded</returns>
+		virtual bool UnloadStreamHead(const std::string& filename) = 0;
+
+		/// <summary>
+		/// Set the read-ahead and the worker threads of streamed sounds.
+		/// </summary>
+		/// <param name="settings">Streaming settings</param>
+		virtual void SetStreamingSettings(const StreamingSettings& settings);
+
+		/// <summary>
+		/// Get the read-ahead and the worker threads of streamed sounds.
+		/// </summary>
+		/// <returns>Streaming settings</returns>
+		const StreamingSettings& GetStreamingSettings() const;
+
+		/// <summary>
+		/// Get the statistics of a streamed sound.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayAudioFileStream</param>
+		/// <returns>Statistics of the stream, all zero if the sound is not streamed</returns>
+		virtual StreamStats GetStreamStats(size_t soundID) = 0;
+
+		/// <summary>
+		/// Stream a list of audio files back to back as a single sound.
+		/// 
+		/// <para>
+		/// The next track is opened and decoded in the background while the current one plays,
+		/// and it starts on the exact frame the current one ends, or crossfades into it.
+		/// Every track is converted to the output layout, so files with different formats can be joined.
+		/// The sound keeps playing silence when it runs out of tracks, more can be queued with QueuePlaylistTrack.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="filenames">Paths to the audio files, in playing order</param>
+		/// <param name="crossfade">Length of the crossfade between the tracks, 0 for gapless playback</param>
+		/// <returns>Active Sounds List Index</returns>
+		virtual size_t PlayPlaylist(std::span<const std::string> filenames, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) = 0;
+
+		/// <summary>
+		/// Add a track to the end of a playlist.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayPlaylist</param>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="crossfade">Length of the crossfade from the previous track, 0 for a gapless switch</param>
+		/// <returns>True if the track is queued</returns>
+		virtual bool QueuePlaylistTrack(size_t soundID, const std::string& filename, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) = 0;
+
+		/// <summary>
+		/// Move a playlist on to its next track now, e.g. to switch between intensity layers.
+		/// If there's no next track, the current one is faded out.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayPlaylist</param>
+		/// <param name="crossfade">Length of the crossfade from the current position, 0 to switch right away</param>
+		/// <returns>True if the skip is requested</returns>
+		virtual bool SkipPlaylistTrack(size_t soundID, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) = 0;
+
 		// ========================
 		// Sound Management
 		// ========================
@@ -220,6 +966,7 @@ namespace FranAudio::Backend
 
 		/// <summary>
 		/// Stop and clear an active sound by its index.
+		/// Sounds that reach their end are cleared by Update, they don't need to be stopped.
 		/// </summary>
 		/// <param name="soundIndex">Index of the sound in the active sounds list</param>
 		virtual void StopPlayingSound(size_t soundIndex) = 0;
@@ -252,9 +999,71 @@ namespace FranAudio::Backend
 	 	/// <param name="position">Output position of the sound</param>
 		virtual void GetSoundPosition(size_t soundID, float position[3]) = 0;
 
+		/// <summary>
+		/// Move the playback position of a sound.
+		/// Streamed sounds use the seek tables built when they're opened, see StreamingSettings::seekPointCount,
+		/// and play silence until the new position is decoded.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to seek</param>
+		/// <param name="seconds">New position from the start of the sound, in seconds</param>
+		/// <returns>True if the seek is requested</returns>
+		virtual bool SeekSound(size_t soundID, double seconds) = 0;
+
+		/// <summary>
+		/// Set the priority of a sound, used for choosing the sounds that are mixed when there's a real voice limit.
+		/// The audibility of a sound is its volume, times its distance attenuation, times its priority.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to set the priority of</param>
+		/// <param name="priority">Priority of the sound, 1.0 by default. 0 makes it the first to be virtualised.</param>
+		virtual void SetSoundPriority(size_t soundID, float priority) = 0;
+
+		/// <summary>
+		/// Get the priority of a sound.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to get the priority of</param>
+		/// <returns>Priority of the sound</returns>
+		virtual float GetSoundPriority(size_t soundID) = 0;
+
+		/// <summary>
+		/// Set the maximum number of sounds that are mixed at once.
+		/// Every Update, the least audible sounds above the limit are virtualised:
+		/// they're not mixed, but their playback position keeps moving,
+		/// and they're mixed again from where they should be once they're audible enough.
+		/// </summary>
+		/// <param name="maxVoices">Maximum number of mixed sounds, 0 means unlimited</param>
+		void SetMaxRealVoices(size_t maxVoices);
+
+		/// <summary>
+		/// Get the maximum number of sounds that are mixed at once.
+		/// </summary>
+		/// <returns>Maximum number of mixed sounds, 0 means unlimited</returns>
+		size_t GetMaxRealVoices() const;
+
+		/// <summary>
+		/// Set the maximum number of voices an audio file can play at once.
+		/// Applies to the files that are loaded afterwards too. Files that share their data with another file share its limit.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="limit">Instance limit, a maxInstances of 0 removes it</param>
+		void SetInstanceLimit(const std::string& filename, const InstanceLimit& limit);
+
+		/// <summary>
+		/// Put an audio file in an instance group, so its voices count towards the group's limit too.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="group">Name of the group, empty to remove it from its group</param>
+		void SetInstanceGroup(const std::string& filename, const std::string& group);
+
+		/// <summary>
+		/// Set the maximum number of voices the audio files of a group can play at once, in total.
+		/// </summary>
+		/// <param name="group">Name of the group</param>
+		/// <param name="limit">Instance limit, a maxInstances of 0 removes it</param>
+		void SetGroupInstanceLimit(const std::string& group, const InstanceLimit& limit);
+
 		/// <summary>
 		/// Get a reference to a playing sound by its index.
-		/// Index MUST be valid.
+		/// Throws std::out_of_range if the sound is not playing, check it with IsSoundValid first.
 		/// </summary>
 		/// <param name="soundID">ID of the sound to get</param>
 		virtual Sound::Sound& GetSound(size_t soundID);
@@ -263,7 +1072,7 @@ namespace FranAudio::Backend
 		/// Get the map of currently active sounds.
  		/// </summary>
  		/// <returns>Map of currently active sounds</returns>
-		virtual const FranAudioShared::Containers::UnorderedMap<size_t, Sound::Sound>& GetActiveSounds() const;
+		virtual const FranAudioShared::Containers::SlotMap<Sound::Sound>& GetActiveSounds() const;
 
 		/// <summary>
 		/// Retrieves a list of active sound IDs.
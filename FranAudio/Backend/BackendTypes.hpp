@@ -1,7 +1,11 @@
 // FranticDreamer 2022-2025
 #pragma once
 
+#include <string>
 #include <string_view>
+#include <functional>
+#include <chrono>
+#include <cstdint>
 
 namespace FranAudio::Backend
 {
@@ -34,4 +38,222 @@ namespace FranAudio::Backend
 		"MiniAudio",
 		"OpenALSoft",
 	};
+
+	/// <summary>
+	/// Integer handle of a loaded audio file.
+	/// Packs its wave data cache index with the generation of the cache entry, like the SlotMap handles.
+	/// Once the file is unloaded or evicted, the AssetID is rejected, even if its index is reused by another file.
+	/// </summary>
+	using AssetID = size_t;
+
+	/// <summary>
+	/// Invalid AssetID, returned on failures.
+	/// </summary>
+	inline constexpr AssetID InvalidAssetID = SIZE_MAX;
+
+	/// <summary>
+	/// Handle of an asynchronous audio file load.
+	/// SIZE_MAX is an invalid handle.
+	/// </summary>
+	using LoadHandle = size_t;
+
+	/// <summary>
+	/// Possible states of an asynchronous audio file load.
+	/// </summary>
+	enum class LoadStatus
+	{
+		Invalid = 0,	///<summary> Handle is unknown, or the load result was already released. </summary>
+		Queued,			///<summary> Waiting for a free loader thread. </summary>
+		Decoding,		///<summary> Being decoded on a loader thread. </summary>
+		Decoded,		///<summary> Decoded, waiting to be published into the cache by Update(). </summary>
+		Loaded,			///<summary> Published into the cache, ready to be played. </summary>
+		Failed,			///<summary> File couldn't be found or decoded. </summary>
+	};
+
+	/// <summary>
+	/// An array of string views representing the names of load states.
+	/// </summary>
+	inline std::string_view LoadStatusViews[] =
+	{
+		"Invalid",
+		"Queued",
+		"Decoding",
+		"Decoded",
+		"Loaded",
+		"Failed",
+	};
+
+	/// <summary>
+	/// Callback for asynchronous loads.
+	/// Called from the thread that calls Backend::Update().
+	/// 
+	/// Parameters are: load handle, filename, AssetID of the file (InvalidAssetID on failure).
+	/// </summary>
+	using LoadCallback = std::function<void(LoadHandle, const std::string&, AssetID)>;
+
+	/// <summary>
+	/// Aggregate progress of a batch load.
+	/// </summary>
+	struct LoadProgress
+	{
+		size_t filesTotal = 0;		///<summary> Number of unique files in the batch. </summary>
+		size_t filesDone = 0;		///<summary> Number of files that are finished, including the failed ones. </summary>
+		size_t filesFailed = 0;		///<summary> Number of files that couldn't be loaded. </summary>
+		uint64_t bytesTotal = 0;	///<summary> Total size of the files on disk. </summary>
+		uint64_t bytesDone = 0;		///<summary> Size of the finished files on disk. </summary>
+	};
+
+	/// <summary>
+	/// Callback for batch load progress.
+	/// Called from the thread that started the batch load, every time a file is finished.
+	/// </summary>
+	using LoadProgressCallback = std::function<void(const LoadProgress&)>;
+
+	/// <summary>
+	/// How an audio file is kept in the memory after it's loaded.
+	/// </summary>
+	enum class ResidencyMode
+	{
+		Auto = 0,	///<summary> Decided by the stream and compressed size thresholds of the load options. </summary>
+		Decoded,	///<summary> Fully decoded PCM. Costs the most memory, cheapest to play. </summary>
+		Compressed,	///<summary> Encoded file bytes, decoded on demand while playing. </summary>
+		Streamed,	///<summary> Nothing but the format, every voice decodes the file from the disk while playing. </summary>
+	};
+
+	/// <summary>
+	/// An array of string views representing the names of residency modes.
+	/// </summary>
+	inline std::string_view ResidencyModeViews[] =
+	{
+		"Auto",
+		"Decoded",
+		"Compressed",
+		"Streamed",
+	};
+
+	/// <summary>
+	/// Options for loading an audio file.
+	/// Can be set per file, or as the defaults for every file.
+	/// </summary>
+	struct AssetLoadOptions
+	{
+		/// <summary>
+		/// How the file is kept in the memory.
+		/// </summary>
+		ResidencyMode residency = ResidencyMode::Auto;
+
+		/// <summary>
+		/// With Auto residency, files that are at least this big on disk are kept compressed.
+		/// 0 means files are always decoded.
+		/// </summary>
+		uint64_t compressedThreshold = 0;
+
+		/// <summary>
+		/// With Auto residency, files that would take at least this many bytes when decoded are streamed from the disk.
+		/// The decoded size is worked out from the length of the file, or its size on disk if the length can't be read.
+		/// Checked before the compressed threshold. 0 means files are never streamed.
+		/// </summary>
+		uint64_t streamThreshold = 0;
+
+		/// <summary>
+		/// Convert the decoded samples to the output sample rate and channel count of the backend once at load time,
+		/// so the voices of this file don't have to be resampled while playing.
+		/// Changes the memory size of the file, so it's off by default.
+		/// Ignored for compressed files.
+		/// </summary>
+		bool resampleToEngine = false;
+	};
+
+	/// <summary>
+	/// Which voice makes room when a new sound would go over an instance limit.
+	/// </summary>
+	enum class VoiceStealPolicy
+	{
+		Oldest = 0,	///<summary> Stop the voice that started first. </summary>
+		Quietest,	///<summary> Stop the voice with the lowest volume. </summary>
+		Farthest,	///<summary> Stop the voice that's the farthest from the listener. </summary>
+		RejectNew,	///<summary> Don't start the new sound. </summary>
+	};
+
+	/// <summary>
+	/// An array of string views representing the names of voice steal policies.
+	/// </summary>
+	inline std::string_view VoiceStealPolicyViews[] =
+	{
+		"Oldest",
+		"Quietest",
+		"Farthest",
+		"RejectNew",
+	};
+
+	/// <summary>
+	/// Maximum number of voices an asset, or a group of assets, can play at once.
+	/// </summary>
+	struct InstanceLimit
+	{
+		/// <summary>
+		/// Maximum number of voices, 0 means unlimited.
+		/// </summary>
+		size_t maxInstances = 0;
+
+		/// <summary>
+		/// What to do when a new sound would go over the limit.
+		/// </summary>
+		VoiceStealPolicy policy = VoiceStealPolicy::Oldest;
+	};
+
+	/// <summary>
+	/// Target layout for decoding an audio file.
+	/// 0 means the file's own value is kept.
+	/// </summary>
+	struct DecodeSettings
+	{
+		uint32_t sampleRate = 0;
+		uint32_t channels = 0;
+	};
+
+	/// <summary>
+	/// Statistics of a sound that's streamed from the disk.
+	/// </summary>
+	struct StreamStats
+	{
+		uint64_t underruns = 0;			///<summary> Number of times the mixer asked for audio that wasn't decoded yet. </summary>
+		uint64_t underrunFrames = 0;	///<summary> Total number of frames that were replaced with silence. </summary>
+		uint64_t bufferedFrames = 0;	///<summary> Number of frames that are decoded ahead of the mixer right now. </summary>
+		uint64_t capacityFrames = 0;	///<summary> Maximum number of frames that can be decoded ahead of the mixer. </summary>
+		uint64_t reads = 0;				///<summary> Number of times a streaming worker decoded into the buffer. </summary>
+	};
+
+	/// <summary>
+	/// Settings of the streaming workers that decode every streamed sound.
+	/// </summary>
+	struct StreamingSettings
+	{
+		/// <summary>
+		/// Number of worker threads that decode the streams.
+		/// Streams that are closest to running dry are decoded first.
+		/// </summary>
+		uint32_t workerThreads = 1;
+
+		/// <summary>
+		/// Length of the audio that's decoded ahead of the mixer, per stream.
+		/// Longer read-ahead survives slower disks, at the cost of memory per stream.
+		/// Only affects the streams that are started after it's changed.
+		/// </summary>
+		std::chrono::milliseconds readAhead{ 500 };
+
+		/// <summary>
+		/// A stream isn't decoded until at least this much of its buffer is free,
+		/// so the file is read in a few large reads instead of many small ones.
+		/// Streams that are about to run dry are decoded regardless.
+		/// </summary>
+		std::chrono::milliseconds minReadLength{ 100 };
+
+		/// <summary>
+		/// Number of seek points to build when a stream is opened, for the formats that support it (MP3).
+		/// Makes seeking cost the same anywhere in the file, but opening reads through the whole file once, on a streaming worker.
+		/// 0 disables the seek tables, seeking is then linear in the seek position.
+		/// </summary>
+		uint32_t seekPointCount = 1024;
+	};
 }
@@ -1,13 +1,72 @@
 // FranticDreamer 2022-2025
 
 #include <iterator>
+#include <algorithm>
 #include <filesystem>
 #include <thread>
+#include <cmath>
+#include <limits>
 
 #include "Backend_miniaudio.hpp"
 
 #include "FranAudioShared/Logger/Logger.hpp"
 
+namespace
+{
+	/// <summary>
+	/// Number of voices that are allocated at Init.
+	/// If every one of them is playing, the least audible sound is stopped for a new one.
+	/// </summary>
+	constexpr size_t VoicePoolCapacity = 256;
+
+	/// <summary>
+	/// Number of finished sounds that can wait for Update.
+	/// </summary>
+	constexpr size_t FinishedSoundQueueCapacity = 1024;
+
+	/// <summary>
+	/// Audibility of the sounds that are already mixed is scaled up by this much,
+	/// so two sounds around the real voice limit don't keep swapping places every update.
+	/// </summary>
+	constexpr float RealVoiceHysteresis = 1.25f;
+
+	/// <summary>
+	/// Get the distance gain of a sound, the same way miniaudio's spatializer does.
+	/// </summary>
+	float GetDistanceAttenuation(ma_sound* sound, float distance)
+	{
+		const float minDistance = ma_sound_get_min_distance(sound);
+		const float maxDistance = ma_sound_get_max_distance(sound);
+		const float rolloff = ma_sound_get_rolloff(sound);
+
+		float gain = 1.0f;
+		if (minDistance < maxDistance)
+		{
+			const float clampedDistance = std::clamp(distance, minDistance, maxDistance);
+
+			switch (ma_sound_get_attenuation_model(sound))
+			{
+			case ma_attenuation_model_inverse:
+			{
+				const float divisor = minDistance + rolloff * (clampedDistance - minDistance);
+				gain = divisor > 0.0f ? minDistance / divisor : 1.0f;
+				break;
+			}
+			case ma_attenuation_model_linear:
+				gain = 1.0f - rolloff * (clampedDistance - minDistance) / (maxDistance - minDistance);
+				break;
+			case ma_attenuation_model_exponential:
+				gain = minDistance > 0.0f ? std::pow(clampedDistance / minDistance, -rolloff) : 1.0f;
+				break;
+			default:
+				break;
+			}
+		}
+
+		return std::max(ma_sound_get_min_gain(sound), std::min(gain, ma_sound_get_max_gain(sound)));
+	}
+}
+
 bool FranAudio::Backend::miniaudio::Init(FranAudio::Decoder::DecoderType decoderType)
 {
 	engineConfig = ma_engine_config_init();
@@ -63,20 +122,70 @@ bool FranAudio::Backend::miniaudio::Init(FranAudio::Decoder::DecoderType decoder
 	// Decoder will be initialised by the FranAudio::Init
 	currentDecoderType = decoderType;
 
+	streamScheduler.Start(streamingSettings);
+
+	CreateVoicePool();
+
 	return true;
 }
 
 void FranAudio::Backend::miniaudio::Reset()
 {
+	WaitForPendingLoads();
+
+	// Sounds belong to the engine, they can't outlive it
+	DestroyVoicePool();
+
 	ma_engine_uninit(&engine);
 	ma_engine_init(&engineConfig, &engine);
+
+	CreateVoicePool();
 }
 
 void FranAudio::Backend::miniaudio::Shutdown()
 {
+	// Loader threads might still be using our decoder config
+	loaderPool.Stop();
+
+	DestroyVoicePool();
+	streamScheduler.Stop();
+
 	ma_engine_uninit(&engine);
 }
 
+void FranAudio::Backend::miniaudio::Update()
+{
+	Backend::Update();
+
+	ReapFinishedSounds();
+	UpdateVirtualVoices();
+
+	for (MiniaudioSound* miniaudioSound : soundVoices)
+	{
+		if (!miniaudioSound)
+		{
+			continue;
+		}
+
+		if (miniaudioSound->playlist)
+		{
+			miniaudioSound->playlist->Update();
+			continue;
+		}
+
+		if (!miniaudioSound->stream)
+		{
+			continue;
+		}
+
+		const uint64_t newUnderruns = miniaudioSound->stream->TakeNewUnderruns();
+		if (newUnderruns > 0)
+		{
+			FranAudioShared::Logger::LogWarning(std::format("MiniAudio: Stream underran {} times, decoding can't keep up: {}", newUnderruns, miniaudioSound->stream->GetFilename()));
+		}
+	}
+}
+
 // ========================
 // Decoder Management
 // ========================
@@ -149,91 +258,301 @@ float FranAudio::Backend::miniaudio::GetMasterVolume()
 	return ma_engine_get_volume(&engine);
 }
 
+FranAudio::Backend::DecodeSettings FranAudio::Backend::miniaudio::GetOutputSettings()
+{
+	DecodeSettings settings;
+	settings.sampleRate = ma_engine_get_sample_rate(&engine);
+	settings.channels = ma_engine_get_channels(&engine);
+	return settings;
+}
+
 // ========================
 // Audio File Management
 // ========================
 
-size_t FranAudio::Backend::miniaudio::LoadAudioFile(const std::string& filename)
+FranAudio::Backend::AssetID FranAudio::Backend::miniaudio::LoadAudioFile(const std::string& filename)
 {
-	std::filesystem::path filePath(filename);
+	FranAudio::Sound::WaveData waveData;
+	if (!DecodeToWaveData(filename, GetAssetLoadOptions(filename), waveData))
+	{
+		return InvalidAssetID;
+	}
+
+	const AssetID assetID = AddToWaveDataCache(filename, std::move(waveData));
+
+	// Debug
+	// TODO: Remove this
+	//PlayAudioFileNoChecks(filename);
 
-	if (!std::filesystem::exists(filePath))
+	FranAudioShared::Logger::LogSuccess(std::format("MiniAudio: Decoder {} loaded audio file: {}", FranAudio::Decoder::DecoderTypeNames[(int)currentDecoder->GetDecoderType()], filename));
+
+	return assetID;
+}
+
+size_t FranAudio::Backend::miniaudio::PlayAudioFileNoChecks(const std::string& filename)
+{
+	auto it = filenameWaveMap.find(filename); // Filename - Wave data cache index
+	if (it == filenameWaveMap.end())
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: File does not exist: " + filename);
+		FranAudioShared::Logger::LogError("MiniAudio: Audio file not loaded: " + filename);
 		return SIZE_MAX;
 	}
 
-	if (std::filesystem::is_directory(filePath))
+	return PlayAudioAsset(MakeAssetID(it->second));
+}
+
+size_t FranAudio::Backend::miniaudio::PlayAudioAsset(AssetID assetID)
+{
+	// Generate our unique ID
+	const size_t soundID = activeSounds.ReserveHandle();
+
+	if (!StartSound(soundID, assetID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: File is a directory: " + filename);
+		activeSounds.Erase(soundID);
 		return SIZE_MAX;
 	}
 
-	if (std::filesystem::is_empty(filePath))
+	return soundID;
+}
+
+bool FranAudio::Backend::miniaudio::StartSound(size_t soundID, AssetID assetID)
+{
+	auto waveDataPtr = AcquireWaveData(assetID);
+	if (!waveDataPtr)
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: File is empty: " + filename);
-		return SIZE_MAX;
+		FranAudioShared::Logger::LogError("MiniAudio: Tried to play an asset that is not loaded: " + std::to_string(assetID));
+		return false;
 	}
 
-	FranAudio::Sound::WaveData waveData;
-	bool result = currentDecoder->DecodeAudioFile(filename, waveData, *this);
+	if (!MakeRoomForInstance(assetID))
+	{
+		return false;
+	}
+
+	// Only sounds that play from the audio buffer can reuse the sound of a voice
+	const bool playsFromBuffer = !waveDataPtr->IsStreamed() && !waveDataPtr->IsEncoded();
+	MiniaudioSound* miniaudioSound = playsFromBuffer ? AcquireVoice(waveDataPtr->GetChannels(), waveDataPtr->GetSampleRate()) : AcquireVoice();
+	if (!miniaudioSound)
+	{
+		return false;
+	}
+	miniaudioSound->waveData = std::move(waveDataPtr);
+
+	const auto& waveData = *miniaudioSound->waveData;
+
+	ma_data_source* dataSource = nullptr;
+	if (waveData.IsStreamed())
+	{
+		// Too big to keep in memory, decode from the disk while playing
+		miniaudioSound->stream = std::make_unique<MiniaudioStream>();
+		if (!OpenStream(*miniaudioSound->stream, waveData.GetFilename()))
+		{
+			ReleaseVoice(miniaudioSound);
+			return false;
+		}
+		dataSource = miniaudioSound->stream->GetDataSource();
+	}
+	else if (waveData.IsEncoded())
+	{
+		// Compressed resident, decode while playing
+		if (ma_decoder_init_memory(waveData.GetFrameData(), waveData.GetSizeInBytes(), &defaultDecoderConfig, &miniaudioSound->decoder) != MA_SUCCESS)
+		{
+			FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise decoder for compressed audio: " + waveData.GetFilename());
+			ReleaseVoice(miniaudioSound);
+			return false;
+		}
+		miniaudioSound->hasDecoder = true;
+		dataSource = &miniaudioSound->decoder;
+	}
+	else
+	{
+		miniaudioSound->audioBufferConfig = ma_audio_buffer_config_init(ConvertFormat(waveData.GetFormat()), waveData.GetChannels(), waveData.SizeInFrames(), waveData.GetFrameData(), nullptr);
+		miniaudioSound->audioBufferConfig.sampleRate = waveData.GetSampleRate(); // Why is this not set in the config init function?
+		ma_audio_buffer_init(&miniaudioSound->audioBufferConfig, &miniaudioSound->audioBuffer);
+		dataSource = &miniaudioSound->audioBuffer;
+	}
 
-	if (!result)
+	if (!InitVoiceSound(*miniaudioSound, dataSource))
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise sound for audio file: " + waveData.GetFilename());
+		ReleaseVoice(miniaudioSound);
+		return false;
+	}
+
+	if (miniaudioSound->stream)
+	{
+		streamScheduler.Add(miniaudioSound->stream.get());
+	}
+
+	BindVoice(soundID, assetID, miniaudioSound);
+	LinkInstance(miniaudioSound, assetID);
+	ma_sound_set_volume(&miniaudioSound->sound, 1.0f);
+	ma_sound_start(&miniaudioSound->sound);
+
+	return true;
+}
+
+size_t FranAudio::Backend::miniaudio::PlayAudioFileStream(const std::string& filename)
+{
+	MiniaudioSound* miniaudioSound = AcquireVoice();
+	if (!miniaudioSound)
+	{
+		return SIZE_MAX;
+	}
+	miniaudioSound->stream = std::make_unique<MiniaudioStream>();
+	if (!OpenStream(*miniaudioSound->stream, filename))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Failed to decode audio file: " + filename);
+		ReleaseVoice(miniaudioSound);
 		return SIZE_MAX;
 	}
 
-	waveDataCache.emplace_back(waveData);
-	size_t index = waveDataCache.size() - 1;
-	filenameWaveMap[filename] = index;
+	if (!InitVoiceSound(*miniaudioSound, miniaudioSound->stream->GetDataSource()))
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise sound for streaming: " + filename);
+		ReleaseVoice(miniaudioSound);
+		return SIZE_MAX;
+	}
 
-	// Debug
-	// TODO: Remove this
-	//PlayAudioFileNoChecks(filename);
+	// Generate our unique ID
+	const size_t soundID = activeSounds.ReserveHandle();
 
-	FranAudioShared::Logger::LogSuccess(std::format("MiniAudio: Decoder {} loaded audio file: {}", FranAudio::Decoder::DecoderTypeNames[(int)currentDecoder->GetDecoderType()], filename));
+	// Streamed sounds have no wave data
+	BindVoice(soundID, SIZE_MAX, miniaudioSound);
+
+	streamScheduler.Add(miniaudioSound->stream.get());
+	ma_sound_set_volume(&miniaudioSound->sound, 1.0f);
+	ma_sound_start(&miniaudioSound->sound);
+
+	return soundID;
+}
+
+bool FranAudio::Backend::miniaudio::OpenStream(MiniaudioStream& stream, const std::string& filename)
+{
+	// With a head, the file is opened by a streaming worker while the head plays
+	auto headIt = streamHeads.find(filename);
+	if (headIt != streamHeads.end())
+	{
+		return stream.Open(filename, defaultDecoderConfig, streamingSettings, headIt->second);
+	}
+
+	// Opening the decoder can read through the whole file for the seek table, so a streaming worker does it.
+	// The format has to be known before that, so the decoder converts to the engine's.
+	ma_decoder_config decoderConfig = defaultDecoderConfig;
+	decoderConfig.channels = ma_engine_get_channels(&engine);
+	decoderConfig.sampleRate = ma_engine_get_sample_rate(&engine);
 
-	return index;
+	return stream.OpenInBackground(filename, decoderConfig, streamingSettings);
 }
 
-size_t FranAudio::Backend::miniaudio::PlayAudioFile(const std::string& filename)
+bool FranAudio::Backend::miniaudio::LoadStreamHead(const std::string& filename, std::chrono::milliseconds length)
 {
-	return PlayAudioFileNoChecks(filename);
+	auto head = MiniaudioStream::DecodeHead(filename, defaultDecoderConfig, length);
+	if (!head)
+	{
+		return false;
+	}
+
+	FranAudioShared::Logger::LogSuccess(std::format("MiniAudio: Loaded stream head of {} frames: {}", head->frameCount, filename));
+
+	streamHeads[filename] = std::move(head);
+	return true;
 }
 
-size_t FranAudio::Backend::miniaudio::PlayAudioFileNoChecks(const std::string& filename)
+bool FranAudio::Backend::miniaudio::UnloadStreamHead(const std::string& filename)
 {
-	auto it = filenameWaveMap.find(filename); // Filename - Wave data cache index
-	if (it == filenameWaveMap.end())
+	auto it = streamHeads.find(filename);
+	if (it == streamHeads.end())
+	{
+		return false;
+	}
+
+	streamHeads.erase(it);
+	return true;
+}
+
+void FranAudio::Backend::miniaudio::SetStreamingSettings(const StreamingSettings& settings)
+{
+	Backend::SetStreamingSettings(settings);
+	streamScheduler.Start(streamingSettings);
+}
+
+FranAudio::Backend::StreamStats FranAudio::Backend::miniaudio::GetStreamStats(size_t soundID)
+{
+	auto* voice = FindVoice(soundID);
+	if (!voice || !voice->stream)
+	{
+		return StreamStats();
+	}
+
+	return voice->stream->GetStats();
+}
+
+size_t FranAudio::Backend::miniaudio::PlayPlaylist(std::span<const std::string> filenames, std::chrono::milliseconds crossfade)
+{
+	MiniaudioSound* miniaudioSound = AcquireVoice();
+	if (!miniaudioSound)
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Audio file not loaded: " + filename);
 		return SIZE_MAX;
 	}
+	miniaudioSound->playlist = std::make_unique<MiniaudioPlaylist>();
 
-	const auto& waveData = waveDataCache[it->second];
-	auto miniaudioSound = std::make_unique<MiniaudioSound>();
+	if (!miniaudioSound->playlist->Open(defaultDecoderConfig, ma_engine_get_channels(&engine), ma_engine_get_sample_rate(&engine), streamingSettings, &streamScheduler))
+	{
+		ReleaseVoice(miniaudioSound);
+		return SIZE_MAX;
+	}
 
-	miniaudioSound->audioBufferConfig = ma_audio_buffer_config_init(ConvertFormat(waveData.GetFormat()), waveData.GetChannels(), waveData.SizeInFrames(), waveData.GetFrames().data(), nullptr);
-	miniaudioSound->audioBufferConfig.sampleRate = waveData.GetSampleRate(); // Why is this not set in the config init function?
-	ma_audio_buffer_init(&miniaudioSound->audioBufferConfig, &miniaudioSound->audioBuffer);
-	ma_sound_init_from_data_source(&engine, &miniaudioSound->audioBuffer, 0, nullptr, &miniaudioSound->sound);
+	for (size_t i = 0; i < filenames.size(); i++)
+	{
+		auto headIt = streamHeads.find(filenames[i]);
+		miniaudioSound->playlist->Queue(filenames[i], i > 0 ? crossfade : std::chrono::milliseconds(0), headIt != streamHeads.end() ? headIt->second : nullptr);
+	}
+
+	if (!InitVoiceSound(*miniaudioSound, miniaudioSound->playlist->GetDataSource()))
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise sound for playlist");
+		ReleaseVoice(miniaudioSound);
+		return SIZE_MAX;
+	}
 
 	// Generate our unique ID
-	const size_t soundID = nextSoundID++;
+	const size_t soundID = activeSounds.ReserveHandle();
+
+	// Playlists have no wave data
+	BindVoice(soundID, SIZE_MAX, miniaudioSound);
 
-	activeSounds[soundID] = FranAudio::Sound::Sound(soundID, it->second);
 	ma_sound_set_volume(&miniaudioSound->sound, 1.0f);
 	ma_sound_start(&miniaudioSound->sound);
 
-	miniaudioSoundData[soundID] = std::move(miniaudioSound);
-
 	return soundID;
 }
 
-size_t FranAudio::Backend::miniaudio::PlayAudioFileStream(const std::string& filename)
+bool FranAudio::Backend::miniaudio::QueuePlaylistTrack(size_t soundID, const std::string& filename, std::chrono::milliseconds crossfade)
+{
+	auto* voice = FindVoice(soundID);
+	if (!voice || !voice->playlist)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Tried to queue a track on a sound that is not a playlist: " + std::to_string(soundID));
+		return false;
+	}
+
+	auto headIt = streamHeads.find(filename);
+	voice->playlist->Queue(filename, crossfade, headIt != streamHeads.end() ? headIt->second : nullptr);
+	return true;
+}
+
+bool FranAudio::Backend::miniaudio::SkipPlaylistTrack(size_t soundID, std::chrono::milliseconds crossfade)
 {
-	return SIZE_MAX;
+	auto* voice = FindVoice(soundID);
+	if (!voice || !voice->playlist)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Tried to skip a track on a sound that is not a playlist: " + std::to_string(soundID));
+		return false;
+	}
+
+	// The switch itself is done by the audio thread
+	voice->playlist->Skip(crossfade);
+	return true;
 }
 
 // ========================
@@ -242,78 +561,835 @@ size_t FranAudio::Backend::miniaudio::PlayAudioFileStream(const std::string& fil
 
 void FranAudio::Backend::miniaudio::StopPlayingSound(size_t soundID)
 {
-	if (!IsSoundValid(soundID))
+	if (RemoveSound(soundID) || CancelPendingPlay(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Tried to stop an invalid sound.");
 		return;
 	}
-	if (!activeSounds.contains(soundID))
+
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to stop an invalid sound: " + std::to_string(soundID));
+}
+
+void FranAudio::Backend::miniaudio::SetSoundVolume(size_t soundID, float volume)
+{
+	if (auto* voice = FindVoice(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Sound ID is not playing: " + std::to_string(soundID));
+		ma_sound_set_volume(&voice->sound, volume);
 		return;
 	}
-	if (!miniaudioSoundData.contains(soundID))
+
+	if (auto pending = FindPendingPlay(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Sound ID has invalid data: " + std::to_string(soundID));
+		pending->volume = volume;
 		return;
 	}
 
-	auto& soundPtr = miniaudioSoundData[soundID];
-	ma_sound_stop(&soundPtr->sound);
-	ma_sound_uninit(&soundPtr->sound);
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to set volume of an invalid sound.");
+}
+
+float FranAudio::Backend::miniaudio::GetSoundVolume(size_t soundID)
+{
+	if (auto* voice = FindVoice(soundID))
+	{
+		return ma_sound_get_volume(&voice->sound);
+	}
 
-	miniaudioSoundData.erase(soundID);
-	activeSounds.erase(soundID);
+	if (auto pending = FindPendingPlay(soundID))
+	{
+		return pending->volume;
+	}
+
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to get volume of an invalid sound.");
+	return 0.0f;
 }
 
-void FranAudio::Backend::miniaudio::SetSoundVolume(size_t soundID, float volume)
+void FranAudio::Backend::miniaudio::SetSoundPosition(size_t soundID, const float position[3])
 {
-	if (!IsSoundValid(soundID))
+	if (auto* voice = FindVoice(soundID))
+	{
+		ma_sound_set_position(&voice->sound, position[0], position[1], position[2]);
+		return;
+	}
+
+	if (auto pending = FindPendingPlay(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Tried to set volume of an invalid sound.");
+		std::copy(position, position + 3, pending->position);
+		pending->hasPosition = true;
 		return;
 	}
-	ma_sound_set_volume(&miniaudioSoundData[soundID]->sound, volume);
+
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to set position of an invalid sound.");
 }
 
-float FranAudio::Backend::miniaudio::GetSoundVolume(size_t soundID)
+void FranAudio::Backend::miniaudio::GetSoundPosition(size_t soundID, float outPosition[3])
 {
-	if (!IsSoundValid(soundID))
+	if (auto* voice = FindVoice(soundID))
+	{
+		ma_vec3f pos = ma_sound_get_position(&voice->sound);
+		outPosition[0] = pos.x;
+		outPosition[1] = pos.y;
+		outPosition[2] = pos.z;
+		return;
+	}
+
+	if (auto pending = FindPendingPlay(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Tried to get volume of an invalid sound.");
-		return 0.0f;
+		std::copy(pending->position, pending->position + 3, outPosition);
+		return;
 	}
-	return ma_sound_get_volume(&miniaudioSoundData[soundID]->sound);
+
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to get position of an invalid sound.");
 }
 
-void FranAudio::Backend::miniaudio::SetSoundPosition(size_t soundID, const float position[3])
+bool FranAudio::Backend::miniaudio::SeekSound(size_t soundID, double seconds)
 {
-	if (!IsSoundValid(soundID))
+	seconds = std::max(0.0, seconds);
+
+	auto* voice = FindVoice(soundID);
+	if (!voice)
+	{
+		if (auto pending = FindPendingPlay(soundID))
+		{
+			pending->startSeconds = seconds;
+			return true;
+		}
+
+		FranAudioShared::Logger::LogError("MiniAudio: Tried to seek an invalid sound.");
+		return false;
+	}
+
+	auto& sound = voice->sound;
+
+	ma_uint32 sampleRate = 0;
+	if (ma_sound_get_data_format(&sound, nullptr, nullptr, &sampleRate, nullptr, 0) != MA_SUCCESS || sampleRate == 0)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to get the sample rate of sound: " + std::to_string(soundID));
+		return false;
+	}
+
+	if (voice->isVirtual)
+	{
+		// Not mixed, move its virtual cursor instead. It's seeked there once it's realised.
+		voice->virtualCursor = static_cast<ma_uint64>(seconds * sampleRate);
+		voice->virtualStartTime = std::chrono::steady_clock::now();
+		return true;
+	}
+
+	// The seek itself is done by the audio thread
+	return ma_sound_seek_to_pcm_frame(&sound, static_cast<ma_uint64>(seconds * sampleRate)) == MA_SUCCESS;
+}
+
+void FranAudio::Backend::miniaudio::SetSoundPriority(size_t soundID, float priority)
+{
+	if (auto* voice = FindVoice(soundID))
+	{
+		voice->priority = std::max(0.0f, priority);
+		return;
+	}
+
+	if (auto pending = FindPendingPlay(soundID))
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Tried to set position of an invalid sound.");
+		pending->priority = priority;
 		return;
 	}
 
-	ma_sound_set_position(&miniaudioSoundData[soundID]->sound, position[0], position[1], position[2]);
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to set priority of an invalid sound.");
 }
 
-void FranAudio::Backend::miniaudio::GetSoundPosition(size_t soundID, float outPosition[3])
+float FranAudio::Backend::miniaudio::GetSoundPriority(size_t soundID)
+{
+	if (auto* voice = FindVoice(soundID))
+	{
+		return voice->priority;
+	}
+
+	if (auto pending = FindPendingPlay(soundID))
+	{
+		return pending->priority;
+	}
+
+	FranAudioShared::Logger::LogError("MiniAudio: Tried to get priority of an invalid sound.");
+	return 0.0f;
+}
+
+FranAudio::Backend::miniaudio::MiniaudioSound* FranAudio::Backend::miniaudio::FindVoice(size_t soundID)
+{
+	const size_t index = activeSounds.IndexOf(soundID);
+	return index != SIZE_MAX ? soundVoices[index] : nullptr;
+}
+
+void FranAudio::Backend::miniaudio::BindVoice(size_t soundID, AssetID assetID, MiniaudioSound* voice)
+{
+	activeSounds.Emplace(soundID, soundID, assetID);
+
+	const size_t index = FranAudioShared::Containers::SlotMap<FranAudio::Sound::Sound>::GetIndex(soundID);
+	if (index >= soundVoices.size())
+	{
+		soundVoices.resize(activeSounds.GetSlotCount(), nullptr);
+	}
+
+	soundVoices[index] = voice;
+	voice->soundID = soundID;
+}
+
+bool FranAudio::Backend::miniaudio::RemoveSound(size_t soundID)
+{
+	const size_t index = activeSounds.IndexOf(soundID);
+	if (index == SIZE_MAX)
+	{
+		return false;
+	}
+
+	ReleaseVoice(soundVoices[index]);
+	soundVoices[index] = nullptr;
+	activeSounds.Erase(soundID);
+
+	return true;
+}
+
+// ========================
+// Voice Pool
+// ========================
+
+void FranAudio::Backend::miniaudio::CreateVoicePool()
+{
+	silentFrame.assign(ma_engine_get_channels(&engine), 0.0f);
+
+	voicePool.reserve(VoicePoolCapacity);
+	freeVoices.reserve(VoicePoolCapacity);
+	for (size_t i = 0; i < VoicePoolCapacity; i++)
+	{
+		voicePool.push_back(std::make_unique<MiniaudioSound>());
+		voicePool.back()->owner = this;
+		if (!InitIdleVoiceSound(*voicePool.back()))
+		{
+			FranAudioShared::Logger::LogWarning("MiniAudio: Failed to initialise the sound of a voice, it will be initialised when it's played");
+		}
+		freeVoices.push_back(voicePool.back().get());
+	}
+
+	finishedSounds.Allocate(FinishedSoundQueueCapacity);
+	finishedSoundsOverflow = false;
+
+	// So starting a sound doesn't grow them
+	activeSounds.Reserve(VoicePoolCapacity);
+	soundVoices.reserve(VoicePoolCapacity);
+}
+
+void FranAudio::Backend::miniaudio::DestroyVoicePool()
+{
+	for (MiniaudioSound*& miniaudioSound : soundVoices)
+	{
+		if (miniaudioSound)
+		{
+			const size_t soundID = miniaudioSound->soundID;
+			ReleaseVoice(miniaudioSound);
+			activeSounds.Erase(soundID);
+			miniaudioSound = nullptr;
+		}
+	}
+	assetInstances.clear();
+	groupInstances.clear();
+
+	for (auto& voice : voicePool)
+	{
+		if (voice->hasSound)
+		{
+			ma_sound_uninit(&voice->sound);
+		}
+	}
+	freeVoices.clear();
+	voicePool.clear();
+}
+
+FranAudio::Backend::miniaudio::MiniaudioSound* FranAudio::Backend::miniaudio::AcquireVoice(ma_uint32 channels, ma_uint32 sampleRate)
+{
+	if (freeVoices.empty() && !StealVoice())
+	{
+		return nullptr;
+	}
+
+	// A voice whose sound is set up for this format starts without initialising a new one
+	size_t found = freeVoices.size() - 1;
+	if (channels != 0)
+	{
+		for (size_t i = freeVoices.size(); i-- > 0;)
+		{
+			const MiniaudioSound* voice = freeVoices[i];
+			if (voice->hasSound && voice->soundChannels == channels && voice->soundSampleRate == sampleRate)
+			{
+				found = i;
+				break;
+			}
+		}
+	}
+
+	MiniaudioSound* voice = freeVoices[found];
+	freeVoices[found] = freeVoices.back();
+	freeVoices.pop_back();
+	return voice;
+}
+
+bool FranAudio::Backend::miniaudio::StealVoice()
+{
+	MiniaudioSound* victim = nullptr;
+	float victimAudibility = std::numeric_limits<float>::max();
+	for (MiniaudioSound* voice : soundVoices)
+	{
+		// Playlists can't be put back where they'd be, so they're never stolen
+		if (!voice || voice->playlist)
+		{
+			continue;
+		}
+
+		const float audibility = GetAudibility(*voice);
+		if (victim == nullptr || audibility < victimAudibility)
+		{
+			victimAudibility = audibility;
+			victim = voice;
+		}
+	}
+
+	if (victim == nullptr)
+	{
+		FranAudioShared::Logger::LogWarning(std::format("MiniAudio: Every one of {} voices is playing a playlist, can't play a new sound", voicePool.size()));
+		return false;
+	}
+
+	RemoveSound(victim->soundID);
+	return true;
+}
+
+bool FranAudio::Backend::miniaudio::InitIdleVoiceSound(MiniaudioSound& voice)
+{
+	voice.audioBufferConfig = ma_audio_buffer_config_init(ma_format_f32, static_cast<ma_uint32>(silentFrame.size()), 1, silentFrame.data(), nullptr);
+	voice.audioBufferConfig.sampleRate = ma_engine_get_sample_rate(&engine);
+	ma_audio_buffer_init(&voice.audioBufferConfig, &voice.audioBuffer);
+
+	if (ma_sound_init_from_data_source(&engine, &voice.audioBuffer, MA_SOUND_FLAG_NO_DEFAULT_ATTACHMENT, nullptr, &voice.sound) != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	ma_sound_set_end_callback(&voice.sound, &miniaudio::OnSoundEnd, &voice);
+
+	voice.hasSound = true;
+	voice.soundChannels = voice.audioBufferConfig.channels;
+	voice.soundSampleRate = voice.audioBufferConfig.sampleRate;
+
+	return true;
+}
+
+bool FranAudio::Backend::miniaudio::InitVoiceSound(MiniaudioSound& voice, ma_data_source* dataSource)
+{
+	ma_uint32 channels = 0;
+	ma_uint32 sampleRate = 0;
+	ma_data_source_get_data_format(dataSource, nullptr, &channels, &sampleRate, nullptr, 0);
+
+	// The sound still points to the audio buffer, which is filled in place,
+	// and its node is already set up for this many channels and this sample rate
+	if (voice.hasSound && dataSource == &voice.audioBuffer && voice.soundChannels == channels && voice.soundSampleRate == sampleRate)
+	{
+		ma_sound_seek_to_pcm_frame(&voice.sound, 0);
+		ma_sound_set_position(&voice.sound, 0.0f, 0.0f, 0.0f);
+		return ma_node_attach_output_bus(&voice.sound, 0, ma_engine_get_endpoint(&engine), 0) == MA_SUCCESS;
+	}
+
+	if (voice.hasSound)
+	{
+		ma_sound_uninit(&voice.sound);
+		voice.hasSound = false;
+	}
+
+	if (ma_sound_init_from_data_source(&engine, dataSource, 0, nullptr, &voice.sound) != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	ma_sound_set_end_callback(&voice.sound, &miniaudio::OnSoundEnd, &voice);
+
+	voice.hasSound = true;
+	voice.soundChannels = channels;
+	voice.soundSampleRate = sampleRate;
+
+	return true;
+}
+
+void FranAudio::Backend::miniaudio::ReleaseVoice(MiniaudioSound* voice)
+{
+	const bool playedFromBuffer = !voice->stream && !voice->playlist && !voice->hasDecoder;
+	if (voice->hasSound)
+	{
+		ma_sound_stop(&voice->sound);
+
+		if (playedFromBuffer)
+		{
+			// Kept for the next sound of the same format.
+			// Detaching waits for the mixer, so it can't be reading the audio buffer after this.
+			ma_node_detach_output_bus(&voice->sound, 0);
+		}
+		else
+		{
+			// Other data sources are freed below, the sound can't point to them
+			ma_sound_uninit(&voice->sound);
+			voice->hasSound = false;
+		}
+	}
+
+	if (voice->stream)
+	{
+		streamScheduler.Remove(voice->stream.get());
+		voice->stream.reset();
+	}
+	if (voice->playlist)
+	{
+		voice->playlist->Close();
+		voice->playlist.reset();
+	}
+	if (voice->hasDecoder)
+	{
+		ma_decoder_uninit(&voice->decoder);
+		voice->hasDecoder = false;
+	}
+
+	// Streams and playlists allocate anyway, the one-shot that takes this voice next shouldn't have to
+	if (!playedFromBuffer)
+	{
+		InitIdleVoiceSound(*voice);
+	}
+
+	UnlinkInstance(voice);
+
+	voice->waveData.reset();
+	voice->soundID = SIZE_MAX;
+	voice->priority = 1.0f;
+	voice->isVirtual = false;
+	freeVoices.push_back(voice);
+}
+
+void FranAudio::Backend::miniaudio::ReapFinishedSounds()
+{
+	auto reap = [this](MiniaudioSound* voice, size_t soundID)
+	{
+		// The sound might have been stopped already, and its voice reused
+		if (FindVoice(soundID) != voice)
+		{
+			return;
+		}
+
+		RemoveSound(soundID);
+	};
+
+	FinishedSound finished;
+	while (finishedSounds.Read(&finished, 1) == 1)
+	{
+		reap(finished.voice, finished.soundID);
+	}
+
+	if (finishedSoundsOverflow.exchange(false, std::memory_order_acquire))
+	{
+		FranAudioShared::Logger::LogWarning("MiniAudio: Too many sounds finished at once, looking for them");
+
+		std::vector<FinishedSound> atEnd;
+		for (MiniaudioSound* miniaudioSound : soundVoices)
+		{
+			if (miniaudioSound && ma_sound_at_end(&miniaudioSound->sound))
+			{
+				atEnd.push_back({ miniaudioSound, miniaudioSound->soundID });
+			}
+		}
+
+		for (const auto& sound : atEnd)
+		{
+			reap(sound.voice, sound.soundID);
+		}
+	}
+}
+
+void FranAudio::Backend::miniaudio::UpdateVirtualVoices()
+{
+	std::vector<FinishedSound> endedSounds;
+
+	if (maxRealVoices == 0)
+	{
+		// No limit, mix every virtual voice again
+		for (MiniaudioSound* miniaudioSound : soundVoices)
+		{
+			if (miniaudioSound && miniaudioSound->isVirtual && !RealiseVoice(*miniaudioSound))
+			{
+				endedSounds.push_back({ miniaudioSound, miniaudioSound->soundID });
+			}
+		}
+	}
+	else
+	{
+		voiceAudibility.clear();
+		for (MiniaudioSound* miniaudioSound : soundVoices)
+		{
+			if (!miniaudioSound)
+			{
+				continue;
+			}
+
+			// Playlists can't be put back where they'd be, so they're always mixed
+			float audibility = miniaudioSound->playlist ? std::numeric_limits<float>::max() : GetAudibility(*miniaudioSound);
+			if (!miniaudioSound->isVirtual)
+			{
+				audibility *= RealVoiceHysteresis;
+			}
+
+			voiceAudibility.push_back({ miniaudioSound, miniaudioSound->soundID, audibility });
+		}
+
+		const size_t realCount = std::min(maxRealVoices, voiceAudibility.size());
+		if (realCount < voiceAudibility.size())
+		{
+			std::nth_element(voiceAudibility.begin(), voiceAudibility.begin() + realCount, voiceAudibility.end(), [](const VoiceAudibility& a, const VoiceAudibility& b) { return a.audibility > b.audibility; });
+		}
+
+		for (size_t i = 0; i < voiceAudibility.size(); i++)
+		{
+			auto& voice = *voiceAudibility[i].voice;
+			if (i < realCount)
+			{
+				if (voice.isVirtual && !RealiseVoice(voice))
+				{
+					endedSounds.push_back({ &voice, voiceAudibility[i].soundID });
+				}
+			}
+			else if (!voice.isVirtual)
+			{
+				VirtualiseVoice(voice);
+			}
+			else if (HasVirtualVoiceEnded(voice))
+			{
+				endedSounds.push_back({ &voice, voiceAudibility[i].soundID });
+			}
+		}
+	}
+
+	// Virtual sounds aren't mixed, so their end callbacks never fire
+	for (const auto& ended : endedSounds)
+	{
+		RemoveSound(ended.soundID);
+	}
+}
+
+float FranAudio::Backend::miniaudio::GetAudibility(MiniaudioSound& voice)
+{
+	const float gain = ma_sound_get_volume(&voice.sound) * voice.priority;
+	if (gain <= 0.0f || !ma_sound_is_spatialization_enabled(&voice.sound))
+	{
+		return gain;
+	}
+
+	return gain * GetDistanceAttenuation(&voice.sound, GetListenerDistance(voice));
+}
+
+float FranAudio::Backend::miniaudio::GetListenerDistance(MiniaudioSound& voice)
+{
+	ma_vec3f position = ma_sound_get_position(&voice.sound);
+	if (ma_sound_get_positioning(&voice.sound) == ma_positioning_absolute)
+	{
+		const ma_vec3f listener = ma_engine_listener_get_position(&engine, ma_sound_get_listener_index(&voice.sound));
+		position.x -= listener.x;
+		position.y -= listener.y;
+		position.z -= listener.z;
+	}
+
+	return std::sqrt(position.x * position.x + position.y * position.y + position.z * position.z);
+}
+
+void FranAudio::Backend::miniaudio::VirtualiseVoice(MiniaudioSound& voice)
+{
+	// Detaching waits for the mixer, so the cursor doesn't move after this
+	ma_node_detach_output_bus(&voice.sound, 0);
+
+	ma_uint64 cursor = 0;
+	ma_sound_get_cursor_in_pcm_frames(&voice.sound, &cursor);
+
+	voice.virtualCursor = cursor;
+	voice.virtualStartTime = std::chrono::steady_clock::now();
+	voice.isVirtual = true;
+}
+
+bool FranAudio::Backend::miniaudio::RealiseVoice(MiniaudioSound& voice)
+{
+	if (HasVirtualVoiceEnded(voice))
+	{
+		return false;
+	}
+
+	ma_sound_seek_to_pcm_frame(&voice.sound, GetVirtualCursor(voice));
+	ma_node_attach_output_bus(&voice.sound, 0, ma_engine_get_endpoint(&engine), 0);
+	voice.isVirtual = false;
+
+	return true;
+}
+
+ma_uint64 FranAudio::Backend::miniaudio::GetVirtualCursor(MiniaudioSound& voice)
+{
+	const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - voice.virtualStartTime);
+	ma_uint64 cursor = voice.virtualCursor + static_cast<ma_uint64>(elapsed.count()) * voice.soundSampleRate / 1000000;
+
+	ma_uint64 length = 0;
+	if (ma_sound_is_looping(&voice.sound) && ma_sound_get_length_in_pcm_frames(&voice.sound, &length) == MA_SUCCESS && length > 0)
+	{
+		cursor %= length;
+	}
+
+	return cursor;
+}
+
+bool FranAudio::Backend::miniaudio::HasVirtualVoiceEnded(MiniaudioSound& voice)
+{
+	if (ma_sound_is_looping(&voice.sound))
+	{
+		return false;
+	}
+
+	// Unknown length, it can't be told
+	ma_uint64 length = 0;
+	if (ma_sound_get_length_in_pcm_frames(&voice.sound, &length) != MA_SUCCESS || length == 0)
+	{
+		return false;
+	}
+
+	return GetVirtualCursor(voice) >= length;
+}
+
+bool FranAudio::Backend::miniaudio::MakeRoomForInstance(AssetID assetID)
 {
-	if (!IsSoundValid(soundID))
+	const size_t index = GetCacheIndex(assetID);
+	if (index == SIZE_MAX)
+	{
+		return false;
+	}
+
+	const auto& entry = waveDataCache[index];
+	const InstanceLimit& assetLimit = entry.instanceLimit;
+	const InstanceLimit* groupLimit = entry.instanceGroup != SIZE_MAX ? &instanceGroupLimits[entry.instanceGroup] : nullptr;
+
+	if (assetLimit.maxInstances == 0 && (groupLimit == nullptr || groupLimit->maxInstances == 0))
+	{
+		return true;
+	}
+
+	if (groupLimit != nullptr && entry.instanceGroup >= groupInstances.size())
+	{
+		groupInstances.resize(entry.instanceGroup + 1);
+	}
+
+	auto isFull = [](const InstanceList& list, const InstanceLimit& limit) { return limit.maxInstances > 0 && list.count >= limit.maxInstances; };
+
+	// Check both before stopping anything, so a rejected sound doesn't cost another voice
+	InstanceList& assetList = GetAssetInstances(assetID);
+	if (isFull(assetList, assetLimit) && assetLimit.policy == VoiceStealPolicy::RejectNew)
+	{
+		return false;
+	}
+	if (groupLimit != nullptr && isFull(groupInstances[entry.instanceGroup], *groupLimit) && groupLimit->policy == VoiceStealPolicy::RejectNew)
+	{
+		return false;
+	}
+
+	StealInstances(assetList, InstanceList_Asset, assetLimit);
+	if (groupLimit != nullptr)
+	{
+		StealInstances(groupInstances[entry.instanceGroup], InstanceList_Group, *groupLimit);
+	}
+
+	return true;
+}
+
+void FranAudio::Backend::miniaudio::StealInstances(InstanceList& list, InstanceListKind kind, const InstanceLimit& limit)
+{
+	while (limit.maxInstances > 0 && list.count >= limit.maxInstances)
+	{
+		MiniaudioSound* victim = list.oldest;
+
+		if (limit.policy == VoiceStealPolicy::Quietest || limit.policy == VoiceStealPolicy::Farthest)
+		{
+			float victimScore = std::numeric_limits<float>::max();
+			for (MiniaudioSound* voice = list.oldest; voice != nullptr; voice = voice->instanceLinks[kind].next)
+			{
+				// Lowest score loses, so the farthest voice scores the lowest
+				const float score = limit.policy == VoiceStealPolicy::Quietest ? GetAudibility(*voice) : -GetListenerDistance(*voice);
+				if (score < victimScore)
+				{
+					victimScore = score;
+					victim = voice;
+				}
+			}
+		}
+
+		RemoveSound(victim->soundID);
+	}
+}
+
+FranAudio::Backend::miniaudio::InstanceList& FranAudio::Backend::miniaudio::GetAssetInstances(AssetID assetID)
+{
+	const size_t index = GetCacheIndex(assetID);
+	if (index >= assetInstances.size())
+	{
+		assetInstances.resize(index + 1);
+	}
+
+	InstanceList& list = assetInstances[index];
+	if (list.asset != assetID)
+	{
+		// Voices of the old asset stay playing, they're just not counted against the new one
+		for (MiniaudioSound* voice = list.oldest; voice != nullptr;)
+		{
+			MiniaudioSound* next = voice->instanceLinks[InstanceList_Asset].next;
+			voice->instanceLinks[InstanceList_Asset] = InstanceLink();
+			voice->instanceCacheIndex = SIZE_MAX;
+			voice = next;
+		}
+		list = InstanceList();
+		list.asset = assetID;
+	}
+
+	return list;
+}
+
+void FranAudio::Backend::miniaudio::LinkInstance(MiniaudioSound* voice, AssetID assetID)
+{
+	// Voices are counted even without a limit, so one set while they play applies to them too
+	const size_t index = GetCacheIndex(assetID);
+	if (index == SIZE_MAX)
 	{
-		FranAudioShared::Logger::LogError("MiniAudio: Tried to get position of an invalid sound.");
 		return;
 	}
-	ma_vec3f pos = ma_sound_get_position(&miniaudioSoundData[soundID]->sound);
-	outPosition[0] = pos.x;
-	outPosition[1] = pos.y;
-	outPosition[2] = pos.z;
+
+	const auto& entry = waveDataCache[index];
+
+	auto link = [voice](InstanceList& list, InstanceListKind kind)
+	{
+		voice->instanceLinks[kind].previous = list.newest;
+		voice->instanceLinks[kind].next = nullptr;
+		if (list.newest != nullptr)
+		{
+			list.newest->instanceLinks[kind].next = voice;
+		}
+		else
+		{
+			list.oldest = voice;
+		}
+		list.newest = voice;
+		list.count++;
+	};
+
+	link(GetAssetInstances(assetID), InstanceList_Asset);
+	voice->instanceCacheIndex = index;
+
+	if (entry.instanceGroup != SIZE_MAX)
+	{
+		if (entry.instanceGroup >= groupInstances.size())
+		{
+			groupInstances.resize(entry.instanceGroup + 1);
+		}
+		voice->instanceGroup = entry.instanceGroup;
+		link(groupInstances[entry.instanceGroup], InstanceList_Group);
+	}
+}
+
+void FranAudio::Backend::miniaudio::UnlinkInstance(MiniaudioSound* voice)
+{
+	auto unlink = [voice](InstanceList& list, InstanceListKind kind)
+	{
+		InstanceLink& links = voice->instanceLinks[kind];
+		if (links.previous != nullptr)
+		{
+			links.previous->instanceLinks[kind].next = links.next;
+		}
+		else
+		{
+			list.oldest = links.next;
+		}
+		if (links.next != nullptr)
+		{
+			links.next->instanceLinks[kind].previous = links.previous;
+		}
+		else
+		{
+			list.newest = links.previous;
+		}
+		links = InstanceLink();
+		list.count--;
+	};
+
+	if (voice->instanceCacheIndex != SIZE_MAX)
+	{
+		unlink(assetInstances[voice->instanceCacheIndex], InstanceList_Asset);
+		voice->instanceCacheIndex = SIZE_MAX;
+	}
+	if (voice->instanceGroup != SIZE_MAX)
+	{
+		unlink(groupInstances[voice->instanceGroup], InstanceList_Group);
+		voice->instanceGroup = SIZE_MAX;
+	}
+}
+
+void FranAudio::Backend::miniaudio::OnSoundEnd(void* userData, ma_sound*)
+{
+	auto* voice = static_cast<MiniaudioSound*>(userData);
+	auto* backend = voice->owner;
+
+	const FinishedSound finished = { voice, voice->soundID };
+	if (backend->finishedSounds.Write(&finished, 1) != 1)
+	{
+		backend->finishedSoundsOverflow.store(true, std::memory_order_release);
+	}
 }
 
 // ========================
 // Miniaudio Specific
 // ========================
 
+bool FranAudio::Backend::miniaudio::ProbeEncodedAudio(FranAudio::Sound::WaveData& waveData)
+{
+	ma_decoder decoder;
+	if (ma_decoder_init_memory(waveData.GetFrameData(), waveData.GetSizeInBytes(), &defaultDecoderConfig, &decoder) != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	ReadDecoderFormat(decoder, waveData);
+	ma_decoder_uninit(&decoder);
+
+	return true;
+}
+
+bool FranAudio::Backend::miniaudio::ProbeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& waveData)
+{
+	ma_decoder decoder;
+	if (ma_decoder_init_file(filename.c_str(), &defaultDecoderConfig, &decoder) != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	ReadDecoderFormat(decoder, waveData);
+	ma_decoder_uninit(&decoder);
+
+	return true;
+}
+
+void FranAudio::Backend::miniaudio::ReadDecoderFormat(ma_decoder& decoder, FranAudio::Sound::WaveData& waveData)
+{
+	ma_format format;
+	ma_uint32 channels;
+	ma_uint32 sampleRate;
+	ma_uint64 lengthInFrames = 0;
+	ma_decoder_get_data_format(&decoder, &format, &channels, &sampleRate, nullptr, 0);
+	ma_decoder_get_length_in_pcm_frames(&decoder, &lengthInFrames);
+
+	waveData.SetFormat(ConvertFormat(format));
+	waveData.SetChannels(static_cast<char>(channels));
+	waveData.SetSampleRate(static_cast<int>(sampleRate));
+	waveData.SetLength(sampleRate > 0 ? static_cast<double>(lengthInFrames) / sampleRate : 0.0);
+	waveData.SetFrameSize(static_cast<unsigned char>(ma_get_bytes_per_frame(format, channels)));
+}
+
 ma_decoder_config* FranAudio::Backend::miniaudio::GetDefaultDecoderConfig()
 {
 	return &defaultDecoderConfig;
@@ -9,6 +9,8 @@
 //#endif
 
 #include "Backend/Backend.hpp"
+#include "Backend/miniaudio/Stream_miniaudio.hpp"
+#include "Backend/miniaudio/Playlist_miniaudio.hpp"
 #include "Sound/Sound.hpp"
 #include "Sound/WaveData/WaveData.hpp"
 
@@ -31,6 +33,43 @@ namespace FranAudio::Backend
 	class miniaudio : public Backend
 	{
 	private:
+		struct MiniaudioSound;
+
+		/// <summary>
+		/// Lists a voice can be in, see InstanceList.
+		/// </summary>
+		enum InstanceListKind : size_t
+		{
+			InstanceList_Asset = 0,
+			InstanceList_Group,
+			InstanceList_Count,
+		};
+
+		/// <summary>
+		/// Voices of an asset or an instance group, from the oldest to the newest.
+		/// Linked through the voices themselves, so adding and removing never allocates.
+		/// </summary>
+		struct InstanceList
+		{
+			MiniaudioSound* oldest = nullptr;
+			MiniaudioSound* newest = nullptr;
+			size_t count = 0;
+
+			/// <summary>
+			/// AssetID the list counts for. Cache indices are reused, so a list of an older AssetID is stale.
+			/// </summary>
+			AssetID asset = InvalidAssetID;
+		};
+
+		/// <summary>
+		/// Links of a voice in an instance list.
+		/// </summary>
+		struct InstanceLink
+		{
+			MiniaudioSound* previous = nullptr;
+			MiniaudioSound* next = nullptr;
+		};
+
 		ma_engine engine = {};
 		ma_engine_config engineConfig = {};
 		ma_device device = {};
@@ -58,14 +97,326 @@ namespace FranAudio::Backend
 			ma_audio_buffer_config audioBufferConfig = {};
 			ma_audio_buffer audioBuffer = {};
 			ma_sound sound = {};
+
+			/// <summary>
+			/// Decodes the audio data while playing, if it's kept compressed.
+			/// Used instead of the audio buffer when hasDecoder is true.
+			/// </summary>
+			ma_decoder decoder = {};
+			bool hasDecoder = false;
+
+			/// <summary>
+			/// Keeps the audio data alive while the audio buffer or decoder reads from it.
+			/// </summary>
+			FranAudio::Sound::WaveDataPtr waveData;
+
+			/// <summary>
+			/// Decodes the file from the disk while playing, for streamed sounds.
+			/// Used instead of the audio buffer and the decoder when it's set.
+			/// </summary>
+			std::unique_ptr<MiniaudioStream> stream;
+
+			/// <summary>
+			/// Streams a queue of files back to back, for playlist sounds.
+			/// Used instead of everything else when it's set.
+			/// </summary>
+			std::unique_ptr<MiniaudioPlaylist> playlist;
+
+			/// <summary>
+			/// Is the sound initialised?
+			/// Every free voice has a sound for its audio buffer, set up at CreateVoicePool in the engine's format,
+			/// so a play of the same format doesn't have to initialise a new one.
+			/// </summary>
+			bool hasSound = false;
+
+			/// <summary>
+			/// Channels and sample rate of the data source the sound is initialised for.
+			/// </summary>
+			ma_uint32 soundChannels = 0;
+			ma_uint32 soundSampleRate = 0;
+
+			/// <summary>
+			/// Backend that owns the voice, for the end callback.
+			/// </summary>
+			miniaudio* owner = nullptr;
+
+			/// <summary>
+			/// Sound ID the voice is playing, set before the sound is started.
+			/// </summary>
+			size_t soundID = SIZE_MAX;
+
+			/// <summary>
+			/// Priority of the sound, see SetSoundPriority.
+			/// </summary>
+			float priority = 1.0f;
+
+			/// <summary>
+			/// Is the sound detached from the engine, because it's not audible enough to be mixed?
+			/// See UpdateVirtualVoices.
+			/// </summary>
+			bool isVirtual = false;
+
+			/// <summary>
+			/// Cursor of a virtual sound when it was virtualised, in frames of its data source, and the time at that moment.
+			/// Its cursor keeps moving from there in real time. The engine's own time stops if every sound is detached.
+			/// </summary>
+			ma_uint64 virtualCursor = 0;
+			std::chrono::steady_clock::time_point virtualStartTime;
+
+			/// <summary>
+			/// Wave Data Cache Index of the asset and instance group the voice is counted for, SIZE_MAX if none.
+			/// Not an AssetID, it indexes assetInstances directly. See MakeRoomForInstance.
+			/// </summary>
+			size_t instanceCacheIndex = SIZE_MAX;
+			size_t instanceGroup = SIZE_MAX;
+			InstanceLink instanceLinks[InstanceList_Count];
+		};
+
+		/// <summary>
+		/// Audibility of a playing sound, for choosing the sounds that are mixed.
+		/// </summary>
+		struct VoiceAudibility
+		{
+			MiniaudioSound* voice = nullptr;
+			size_t soundID = SIZE_MAX;
+			float audibility = 0.0f;
+		};
+
+		/// <summary>
+		/// A sound that reached its end.
+		/// </summary>
+		struct FinishedSound
+		{
+			MiniaudioSound* voice = nullptr;
+			size_t soundID = SIZE_MAX;
 		};
 
 		/// <summary>
-		/// A map of active sounds' corresponding data in a format that miniaudio can play.
+		/// Every voice, allocated at Init and reused for every sound.
+		/// The pool never grows, and voices are never freed until Shutdown, so pointers to them stay valid.
+		/// </summary>
+		std::vector<std::unique_ptr<MiniaudioSound>> voicePool;
+
+		/// <summary>
+		/// Voices that are not playing anything.
+		/// </summary>
+		std::vector<MiniaudioSound*> freeVoices;
+
+		/// <summary>
+		/// One silent frame in the engine's format, the audio buffer of every free voice.
+		/// </summary>
+		std::vector<float> silentFrame;
+
+		/// <summary>
+		/// Sounds that reached their end, from the audio thread to Update.
+		/// </summary>
+		FranAudioShared::Containers::RingBuffer<FinishedSound> finishedSounds;
+
+		/// <summary>
+		/// Set by the audio thread if finishedSounds was full,
+		/// so Update looks for the finished sounds itself.
+		/// </summary>
+		std::atomic<bool> finishedSoundsOverflow = false;
+
+		/// <summary>
+		/// Audibility of every playing sound, reused by every UpdateVirtualVoices.
+		/// </summary>
+		std::vector<VoiceAudibility> voiceAudibility;
+
+		/// <summary>
+		/// Playing voices of every asset, by Wave Data Cache Index.
+		/// </summary>
+		std::vector<InstanceList> assetInstances;
+
+		/// <summary>
+		/// Playing voices of every instance group, by group index.
+		/// </summary>
+		std::vector<InstanceList> groupInstances;
+
+		/// <summary>
+		/// Voices of the active sounds in the voice pool, by their slot index in activeSounds.
+		/// nullptr for the slots that are not playing.
 		/// 
 		/// This is used for making miniaudio interaction easier.
 		/// </summary>
-		FranAudioShared::Containers::UnorderedMap<size_t, std::unique_ptr<MiniaudioSound>> miniaudioSoundData;
+		std::vector<MiniaudioSound*> soundVoices;
+
+		/// <summary>
+		/// Decodes every streamed sound from shared worker threads.
+		/// </summary>
+		MiniaudioStreamScheduler streamScheduler;
+
+		/// <summary>
+		/// Decoded starts of the files that are streamed, see LoadStreamHead.
+		/// </summary>
+		FranAudioShared::Containers::StringMap<std::shared_ptr<const MiniaudioStreamHead>> streamHeads;
+
+	protected:
+		virtual bool ProbeEncodedAudio(FranAudio::Sound::WaveData& waveData) override;
+		virtual bool ProbeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& waveData) override;
+
+		/// <summary>
+		/// Create a miniaudio sound for a loaded audio file and start it.
+		/// </summary>
+		/// <param name="soundID">Sound ID to use, reserved by the caller</param>
+		/// <param name="assetID">AssetID of the loaded file</param>
+		/// <returns>True if the sound is started</returns>
+		virtual bool StartSound(size_t soundID, AssetID assetID) override;
+
+		/// <summary>
+		/// Allocate the voice pool with the sounds of its voices, and reserve the sound maps for it.
+		/// </summary>
+		void CreateVoicePool();
+
+		/// <summary>
+		/// Release every playing voice and free the voice pool.
+		/// The engine must still be initialised.
+		/// </summary>
+		void DestroyVoicePool();
+
+		/// <summary>
+		/// Take a free voice from the voice pool, preferring one whose sound is already set up for the format.
+		/// If every voice is playing, the least audible sound is stopped for it.
+		/// </summary>
+		/// <param name="channels">Channels of the audio buffer to play, 0 for a voice that doesn't play from its audio buffer</param>
+		/// <param name="sampleRate">Sample rate of the audio buffer to play</param>
+		/// <returns>A voice that's not playing, nullptr if none could be freed</returns>
+		MiniaudioSound* AcquireVoice(ma_uint32 channels = 0, ma_uint32 sampleRate = 0);
+
+		/// <summary>
+		/// Stop the least audible sound to free its voice. Playlists are never stopped.
+		/// </summary>
+		/// <returns>True if a voice is freed</returns>
+		bool StealVoice();
+
+		/// <summary>
+		/// Initialise the sound of a free voice for a silent audio buffer in the engine's format, detached from the engine.
+		/// </summary>
+		/// <param name="voice">Voice without a sound</param>
+		/// <returns>True if the sound is initialised</returns>
+		bool InitIdleVoiceSound(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Open a stream without touching the file on the calling thread.
+		/// A streaming worker opens the file, while the stream plays its head or silence.
+		/// </summary>
+		/// <param name="stream">Stream to open</param>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>True if the stream is ready to be scheduled</returns>
+		bool OpenStream(MiniaudioStream& stream, const std::string& filename);
+
+		/// <summary>
+		/// Initialise the sound of a voice for a data source and attach it to the engine.
+		/// If the voice already has a sound for its audio buffer in the same format, it's reused without any allocation.
+		/// Otherwise a new sound is initialised, which allocates.
+		/// </summary>
+		/// <param name="voice">Voice to play with</param>
+		/// <param name="dataSource">Data source to play, owned by the voice</param>
+		/// <returns>True if the sound is ready to start</returns>
+		bool InitVoiceSound(MiniaudioSound& voice, ma_data_source* dataSource);
+
+		/// <summary>
+		/// Stop a voice, free its data sources and give it back to the voice pool.
+		/// </summary>
+		/// <param name="voice">Voice to release</param>
+		void ReleaseVoice(MiniaudioSound* voice);
+
+		/// <summary>
+		/// Get the voice of an active sound.
+		/// One bounds check and one generation check, stale Sound IDs don't find the voice that reused their slot.
+		/// </summary>
+		/// <param name="soundID">ID of the sound</param>
+		/// <returns>Voice of the sound, nullptr if it's not playing</returns>
+		MiniaudioSound* FindVoice(size_t soundID);
+
+		/// <summary>
+		/// Add a started voice to activeSounds with its reserved Sound ID.
+		/// </summary>
+		void BindVoice(size_t soundID, AssetID assetID, MiniaudioSound* voice);
+
+		/// <summary>
+		/// Release the voice of an active sound and remove it from activeSounds.
+		/// </summary>
+		/// <returns>False if the sound is not playing</returns>
+		bool RemoveSound(size_t soundID);
+
+		/// <summary>
+		/// Stop the sounds that reached their end and give their voices and wave data back.
+		/// </summary>
+		void ReapFinishedSounds();
+
+		/// <summary>
+		/// End callback of every voice. Called from the audio thread.
+		/// </summary>
+		static void OnSoundEnd(void* userData, ma_sound* sound);
+
+		/// <summary>
+		/// Mix the most audible sounds up to the real voice limit and virtualise the rest.
+		/// Virtual sounds that reached their end are released.
+		/// </summary>
+		void UpdateVirtualVoices();
+
+		/// <summary>
+		/// Get how loud a voice is at the listener: its volume, times its distance attenuation, times its priority.
+		/// </summary>
+		float GetAudibility(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Detach a voice from the engine, keeping track of its cursor.
+		/// </summary>
+		void VirtualiseVoice(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Attach a virtual voice back to the engine, at the position it would be if it was mixed all along.
+		/// </summary>
+		/// <returns>False if the voice reached its end while it was virtual</returns>
+		bool RealiseVoice(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Get the cursor a virtual voice would be at now, in frames of its data source.
+		/// </summary>
+		/// <returns>Cursor of the voice, wrapped for looping sounds</returns>
+		ma_uint64 GetVirtualCursor(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Has a virtual voice reached its end?
+		/// </summary>
+		bool HasVirtualVoiceEnded(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Get the distance between a voice and its listener.
+		/// </summary>
+		float GetListenerDistance(MiniaudioSound& voice);
+
+		/// <summary>
+		/// Stop voices of an asset and its group until a new one fits in their instance limits.
+		/// Only the voices of the asset or the group are looked at, so it's O(1) for the oldest policy
+		/// and linear in the instance limit for the others.
+		/// </summary>
+		/// <param name="assetID">AssetID of the new sound</param>
+		/// <returns>False if the new sound is rejected</returns>
+		bool MakeRoomForInstance(AssetID assetID);
+
+		/// <summary>
+		/// Stop voices of an instance list until it has room for one more.
+		/// </summary>
+		void StealInstances(InstanceList& list, InstanceListKind kind, const InstanceLimit& limit);
+
+		/// <summary>
+		/// Get the instance list of an asset, emptying it first if it still counts voices of an older AssetID.
+		/// </summary>
+		/// <param name="assetID">AssetID of the asset, must not be stale</param>
+		InstanceList& GetAssetInstances(AssetID assetID);
+
+		/// <summary>
+		/// Add a started voice to the instance lists of its asset and group.
+		/// </summary>
+		void LinkInstance(MiniaudioSound* voice, AssetID assetID);
+
+		/// <summary>
+		/// Remove a voice from the instance lists it's in.
+		/// </summary>
+		void UnlinkInstance(MiniaudioSound* voice);
 
 	public:
 		//miniaudio();
@@ -95,6 +446,14 @@ namespace FranAudio::Backend
 		/// <returns>Type of this Backend instance</returns>
 		virtual constexpr BackendType GetBackendType() const noexcept override { return BackendType::miniaudio; }
 
+		/// <summary>
+		/// Update the backend.
+		/// Publishes finished asynchronous loads, releases the sounds that reached their end,
+		/// virtualises the sounds above the real voice limit,
+		/// reports the stream underruns and opens the next playlist tracks.
+		/// </summary>
+		virtual void Update() override;
+
 		// ========================
 		// Decoder Management
 		// ========================
@@ -163,6 +522,12 @@ namespace FranAudio::Backend
  		/// </summary>
  		virtual float GetMasterVolume() override; // Not const because some audio backends might require non-const pointer.
 
+		/// <summary>
+		/// Get the layout the engine mixes and outputs audio in.
+		/// </summary>
+		/// <returns>Engine sample rate and channel count</returns>
+		virtual DecodeSettings GetOutputSettings() override;
+
 		// ========================
 		// Audio File Management
 		// ========================
@@ -171,16 +536,8 @@ namespace FranAudio::Backend
 		/// Decode an audio file and load it into the memory.
 		/// </summary>
 		/// <param name="filename">Path to the audio file</param>
-		/// <returns>Wave Data Cache Index</returns>
-		virtual size_t LoadAudioFile(const std::string& filename) override;
-
-		/// <summary>
-		/// Play an audio file after checking if it's loaded.
-		/// If the audio file is not loaded, it will be loaded and then played.
-		/// </summary>
-		/// <param name="filename">Path to the audio file</param>
-		/// <returns>Active Sounds List Index</returns>
-		virtual size_t PlayAudioFile(const std::string& filename) override;
+		/// <returns>AssetID of the file, InvalidAssetID if it can't be loaded</returns>
+		virtual AssetID LoadAudioFile(const std::string& filename) override;
 
 		/// <summary>
 		/// Play an audio file without checking if it's loaded.
@@ -193,11 +550,73 @@ namespace FranAudio::Backend
 		/// <summary>
 		/// Play an audio file without loading it, stream it from the disk.
 		/// This is used to play an audio file without loading it into memory.
+		/// The file is opened by a streaming worker, a file that can't be opened ends right away.
 		/// </summary>
 		/// <param name="filename">Path to the audio file</param>
 		/// <returns>Active Sounds List Index</returns>
 		virtual size_t PlayAudioFileStream(const std::string& filename) override;
 
+		/// <summary>
+		/// Keep the start of an audio file decoded in memory, so PlayAudioFileStream can start it without touching the disk.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="length">Length of the start to keep</param>
+		/// <returns>True if the head is loaded</returns>
+		virtual bool LoadStreamHead(const std::string& filename, std::chrono::milliseconds length) override;
+
+		/// <summary>
+		/// Remove the decoded start of an audio file from memory.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <returns>True if the file had a head loaded</returns>
+		virtual bool UnloadStreamHead(const std::string& filename) override;
+
+		/// <summary>
+		/// Set the read-ahead and the worker threads of streamed sounds.
+		/// Restarts the streaming workers.
+		/// </summary>
+		/// <param name="settings">Streaming settings</param>
+		virtual void SetStreamingSettings(const StreamingSettings& settings) override;
+
+		/// <summary>
+		/// Get the statistics of a streamed sound.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayAudioFileStream</param>
+		/// <returns>Statistics of the stream, all zero if the sound is not streamed</returns>
+		virtual StreamStats GetStreamStats(size_t soundID) override;
+
+		/// <summary>
+		/// Stream a list of audio files back to back as a single sound.
+		/// </summary>
+		/// <param name="filenames">Paths to the audio files, in playing order</param>
+		/// <param name="crossfade">Length of the crossfade between the tracks, 0 for gapless playback</param>
+		/// <returns>Active Sounds List Index</returns>
+		virtual size_t PlayPlaylist(std::span<const std::string> filenames, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) override;
+
+		/// <summary>
+		/// Add a track to the end of a playlist.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayPlaylist</param>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="crossfade">Length of the crossfade from the previous track, 0 for a gapless switch</param>
+		/// <returns>True if the track is queued</returns>
+		virtual bool QueuePlaylistTrack(size_t soundID, const std::string& filename, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) override;
+
+		/// <summary>
+		/// Move a playlist on to its next track now.
+		/// </summary>
+		/// <param name="soundID">ID returned by PlayPlaylist</param>
+		/// <param name="crossfade">Length of the crossfade from the current position, 0 to switch right away</param>
+		/// <returns>True if the skip is requested</returns>
+		virtual bool SkipPlaylistTrack(size_t soundID, std::chrono::milliseconds crossfade = std::chrono::milliseconds(0)) override;
+
+		/// <summary>
+		/// Play a loaded audio file by its AssetID.
+		/// </summary>
+		/// <param name="assetID">AssetID returned by LoadAudioFile or GetAssetID</param>
+		/// <returns>Active Sounds List Index</returns>
+		virtual size_t PlayAudioAsset(AssetID assetID) override;
+
 		// ========================
 		// Sound Management
 		// ========================
@@ -242,6 +661,28 @@ namespace FranAudio::Backend
  		/// <param name="soundID">ID of the sound to get the position of</param>
 		virtual void GetSoundPosition(size_t soundID, float outPosition[3]) override;
 
+		/// <summary>
+		/// Move the playback position of a sound.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to seek</param>
+		/// <param name="seconds">New position from the start of the sound, in seconds</param>
+		/// <returns>True if the seek is requested</returns>
+		virtual bool SeekSound(size_t soundID, double seconds) override;
+
+		/// <summary>
+		/// Set the priority of a sound, used for choosing the sounds that are mixed.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to set the priority of</param>
+		/// <param name="priority">Priority of the sound, 1.0 by default</param>
+		virtual void SetSoundPriority(size_t soundID, float priority) override;
+
+		/// <summary>
+		/// Get the priority of a sound.
+		/// </summary>
+		/// <param name="soundID">ID of the sound to get the priority of</param>
+		/// <returns>Priority of the sound</returns>
+		virtual float GetSoundPriority(size_t soundID) override;
+
 		// ========================
 		// Miniaudio Specific
 		// ========================
@@ -265,5 +706,12 @@ namespace FranAudio::Backend
 		/// <param name="format">FranAudio format</param>
 		/// <returns>miniaudio format</returns>
 		static ma_format ConvertFormat(Sound::WaveFormat format);
+
+		/// <summary>
+		/// Fill the format, channels, sample rate and length of a WaveData from an initialised decoder.
+		/// </summary>
+		/// <param name="decoder">Decoder of the audio</param>
+		/// <param name="waveData">Target WaveData</param>
+		static void ReadDecoderFormat(ma_decoder& decoder, Sound::WaveData& waveData);
 	};
 }
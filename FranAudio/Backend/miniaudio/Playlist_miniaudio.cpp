@@ -0,0 +1,357 @@
+// FranticDreamer 2022-2025
+
+#include <algorithm>
+#include <format>
+
+#include "Playlist_miniaudio.hpp"
+
+#include "FranAudioShared/Logger/Logger.hpp"
+
+namespace
+{
+	/// <summary>
+	/// Maximum number of frames mixed at once while crossfading.
+	/// </summary>
+	constexpr size_t MixChunkFrames = 4096;
+
+	/// <summary>
+	/// Capacity of the track queues between the main thread and the audio thread.
+	/// Only one track is ready ahead at a time, so a few slots are plenty.
+	/// </summary>
+	constexpr size_t TrackQueueCapacity = 8;
+}
+
+ma_data_source_vtable FranAudio::Backend::MiniaudioPlaylist::dataSourceVTable =
+{
+	&MiniaudioPlaylist::OnRead,
+	nullptr,	// onSeek
+	&MiniaudioPlaylist::OnGetDataFormat,
+	nullptr,	// onGetCursor
+	nullptr,	// onGetLength
+	nullptr,	// onSetLooping
+	0,			// flags
+};
+
+FranAudio::Backend::MiniaudioPlaylist::~MiniaudioPlaylist()
+{
+	Close();
+}
+
+bool FranAudio::Backend::MiniaudioPlaylist::Open(const ma_decoder_config& decoderConfig, ma_uint32 outputChannels, ma_uint32 outputSampleRate, const StreamingSettings& settings, MiniaudioStreamScheduler* scheduler)
+{
+	Close();
+
+	if (outputChannels == 0 || outputSampleRate == 0)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Playlist needs an output format");
+		return false;
+	}
+
+	channels = outputChannels;
+	sampleRate = outputSampleRate;
+	streamingSettings = settings;
+	this->scheduler = scheduler;
+
+	// Every track is converted to the same format, so they can be joined on any frame
+	this->decoderConfig = decoderConfig;
+	this->decoderConfig.channels = channels;
+	this->decoderConfig.sampleRate = sampleRate;
+
+	ma_data_source_config dataSourceConfig = ma_data_source_config_init();
+	dataSourceConfig.vtable = &dataSourceVTable;
+	if (ma_data_source_init(&dataSourceConfig, &dataSourceBase) != MA_SUCCESS)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise data source for playlist");
+		return false;
+	}
+	isOpen = true;
+
+	readyTracks.Allocate(TrackQueueCapacity);
+	finishedTracks.Allocate(TrackQueueCapacity);
+	mixBuffer.resize(MixChunkFrames * channels);
+
+	tracksSent = 0;
+	tracksStarted = 0;
+	skipRequests = 0;
+	skipsDone = 0;
+	currentTrack = nullptr;
+	nextTrack = nullptr;
+	fadeTrack = nullptr;
+	isFading = false;
+
+	return true;
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::Close()
+{
+	for (auto& track : openTracks)
+	{
+		scheduler->Remove(&track->stream);
+	}
+	openTracks.clear();
+	currentTrack = nullptr;
+	nextTrack = nullptr;
+	fadeTrack = nullptr;
+	queuedTracks.clear();
+
+	if (isOpen)
+	{
+		ma_data_source_uninit(&dataSourceBase);
+		isOpen = false;
+	}
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::Queue(const std::string& filename, std::chrono::milliseconds crossfade, std::shared_ptr<const MiniaudioStreamHead> head)
+{
+	// Heads are decoded in the file's own format, they can only be joined if it's the output format
+	if (head && (head->channels != channels || head->sampleRate != sampleRate))
+	{
+		head = nullptr;
+	}
+
+	queuedTracks.push_back({ filename, crossfade, std::move(head) });
+	OpenQueuedTracks();
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::Skip(std::chrono::milliseconds crossfade)
+{
+	skipCrossfadeFrames.store(MillisecondsToFrames(crossfade), std::memory_order_relaxed);
+	skipRequests.fetch_add(1, std::memory_order_release);
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::Update()
+{
+	Track* finished = nullptr;
+	while (finishedTracks.Read(&finished, 1) == 1)
+	{
+		scheduler->Remove(&finished->stream);
+		std::erase_if(openTracks, [finished](const std::unique_ptr<Track>& track) { return track.get() == finished; });
+	}
+
+	for (auto& track : openTracks)
+	{
+		const uint64_t newUnderruns = track->stream.TakeNewUnderruns();
+		if (newUnderruns > 0)
+		{
+			FranAudioShared::Logger::LogWarning(std::format("MiniAudio: Playlist track underran {} times, decoding can't keep up: {}", newUnderruns, track->stream.GetFilename()));
+		}
+	}
+
+	OpenQueuedTracks();
+}
+
+uint64_t FranAudio::Backend::MiniaudioPlaylist::GetTracksStarted() const
+{
+	return tracksStarted.load(std::memory_order_relaxed);
+}
+
+ma_data_source* FranAudio::Backend::MiniaudioPlaylist::GetDataSource()
+{
+	return &dataSourceBase;
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::OpenQueuedTracks()
+{
+	if (!isOpen)
+	{
+		return;
+	}
+
+	// Keep one track ready behind the current one, the rest stay closed until their turn
+	while (!queuedTracks.empty() && tracksSent == tracksStarted.load(std::memory_order_acquire))
+	{
+		QueuedTrack queued = std::move(queuedTracks.front());
+		queuedTracks.pop_front();
+
+		auto track = std::make_unique<Track>();
+		track->crossfadeFrames = MillisecondsToFrames(queued.crossfade);
+
+		// Opened by a streaming worker, the first track plays silence until its start is decoded
+		if (!track->stream.OpenInBackground(queued.filename, decoderConfig, streamingSettings, std::move(queued.head)))
+		{
+			FranAudioShared::Logger::LogError("MiniAudio: Failed to open playlist track, skipping it: " + queued.filename);
+			continue;
+		}
+
+		scheduler->Add(&track->stream);
+
+		Track* readyTrack = track.get();
+		openTracks.push_back(std::move(track));
+		readyTracks.Write(&readyTrack, 1);
+		tracksSent++;
+	}
+}
+
+uint64_t FranAudio::Backend::MiniaudioPlaylist::MillisecondsToFrames(std::chrono::milliseconds length) const
+{
+	return static_cast<uint64_t>(sampleRate) * std::max<int64_t>(0, length.count()) / 1000;
+}
+
+// ========================
+// Audio Thread
+// These run on the audio thread, so no locks or allocations.
+// ========================
+
+void FranAudio::Backend::MiniaudioPlaylist::FetchNextTrack()
+{
+	if (nextTrack == nullptr)
+	{
+		readyTracks.Read(&nextTrack, 1);
+	}
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::AdvanceTrack()
+{
+	if (currentTrack != nullptr)
+	{
+		finishedTracks.Write(&currentTrack, 1);
+	}
+
+	currentTrack = nextTrack;
+	nextTrack = nullptr;
+	fadeTrack = nullptr;
+	isFading = false;
+
+	if (currentTrack != nullptr)
+	{
+		tracksStarted.fetch_add(1, std::memory_order_release);
+	}
+}
+
+void FranAudio::Backend::MiniaudioPlaylist::StartFade(uint64_t length)
+{
+	isFading = true;
+	fadeLength = length;
+	fadePosition = 0;
+	fadeTrack = nextTrack;
+}
+
+ma_result FranAudio::Backend::MiniaudioPlaylist::OnRead(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesReadOut)
+{
+	auto* playlist = reinterpret_cast<MiniaudioPlaylist*>(dataSource);
+	auto* output = static_cast<float*>(framesOut);
+	const ma_uint32 channels = playlist->channels;
+
+	ma_uint64 framesWritten = 0;
+	while (framesWritten < frameCount)
+	{
+		playlist->FetchNextTrack();
+
+		const uint32_t skipRequests = playlist->skipRequests.load(std::memory_order_acquire);
+		if (skipRequests != playlist->skipsDone)
+		{
+			playlist->skipsDone = skipRequests;
+
+			// Nothing to skip if no track is playing
+			if (playlist->currentTrack != nullptr)
+			{
+				const uint64_t skipFrames = playlist->skipCrossfadeFrames.load(std::memory_order_relaxed);
+				if (skipFrames == 0)
+				{
+					playlist->AdvanceTrack();
+					continue;
+				}
+
+				playlist->StartFade(skipFrames);
+			}
+		}
+
+		if (playlist->currentTrack == nullptr)
+		{
+			if (playlist->nextTrack == nullptr)
+			{
+				// Ran out of tracks, wait for more with silence
+				break;
+			}
+
+			playlist->AdvanceTrack();
+			continue;
+		}
+
+		Track* current = playlist->currentTrack;
+		Track* next = playlist->nextTrack;
+
+		// Start the crossfade early enough to finish on the last frame of the current track
+		if (!playlist->isFading && next != nullptr && next->crossfadeFrames > 0)
+		{
+			const uint64_t length = current->stream.GetLengthInFrames();
+			if (length > current->framesPlayed && length - current->framesPlayed <= next->crossfadeFrames)
+			{
+				playlist->StartFade(length - current->framesPlayed);
+			}
+		}
+
+		ma_uint64 chunkFrames = std::min<ma_uint64>(frameCount - framesWritten, MixChunkFrames);
+		if (playlist->isFading)
+		{
+			chunkFrames = std::min<ma_uint64>(chunkFrames, playlist->fadeLength - playlist->fadePosition);
+		}
+
+		float* chunkOutput = output + framesWritten * channels;
+
+		ma_uint64 currentFrames = 0;
+		ma_data_source_read_pcm_frames(current->stream.GetDataSource(), chunkOutput, chunkFrames, &currentFrames);
+		current->framesPlayed = current->stream.GetCursor();
+
+		if (!playlist->isFading)
+		{
+			framesWritten += currentFrames;
+			if (currentFrames < chunkFrames)
+			{
+				// Current track ended, the next one continues on the very next frame
+				playlist->AdvanceTrack();
+			}
+			continue;
+		}
+
+		std::fill(chunkOutput + currentFrames * channels, chunkOutput + chunkFrames * channels, 0.0f);
+
+		ma_uint64 fadeFrames = 0;
+		Track* fadeTrack = playlist->fadeTrack;
+		if (fadeTrack != nullptr)
+		{
+			ma_data_source_read_pcm_frames(fadeTrack->stream.GetDataSource(), playlist->mixBuffer.data(), chunkFrames, &fadeFrames);
+			fadeTrack->framesPlayed = fadeTrack->stream.GetCursor();
+		}
+		std::fill(playlist->mixBuffer.data() + fadeFrames * channels, playlist->mixBuffer.data() + chunkFrames * channels, 0.0f);
+
+		// Linear, since the layers that are crossfaded are usually correlated
+		const float fadeLength = static_cast<float>(playlist->fadeLength);
+		for (ma_uint64 frame = 0; frame < chunkFrames; frame++)
+		{
+			const float gain = static_cast<float>(playlist->fadePosition + frame + 1) / fadeLength;
+			for (ma_uint32 channel = 0; channel < channels; channel++)
+			{
+				const size_t sample = frame * channels + channel;
+				chunkOutput[sample] = chunkOutput[sample] * (1.0f - gain) + playlist->mixBuffer[sample] * gain;
+			}
+		}
+
+		playlist->fadePosition += chunkFrames;
+		framesWritten += chunkFrames;
+
+		if (playlist->fadePosition >= playlist->fadeLength)
+		{
+			// Faded track was read along, it continues from where the fade left it
+			playlist->AdvanceTrack();
+		}
+	}
+
+	// A playlist never ends on its own, more tracks can be queued at any time
+	std::fill(output + framesWritten * channels, output + frameCount * channels, 0.0f);
+
+	*framesReadOut = frameCount;
+	return MA_SUCCESS;
+}
+
+ma_result FranAudio::Backend::MiniaudioPlaylist::OnGetDataFormat(ma_data_source* dataSource, ma_format* format, ma_uint32* channels, ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap)
+{
+	auto* playlist = reinterpret_cast<MiniaudioPlaylist*>(dataSource);
+
+	*format = ma_format_f32;
+	*channels = playlist->channels;
+	*sampleRate = playlist->sampleRate;
+	ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, channelMapCap, playlist->channels);
+
+	return MA_SUCCESS;
+}
@@ -0,0 +1,226 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "miniaudio.h"
+
+#include "Backend/BackendTypes.hpp"
+#include "Backend/miniaudio/Stream_miniaudio.hpp"
+
+#include "FranAudioShared/Containers/RingBuffer.hpp"
+
+namespace FranAudio::Backend
+{
+	/// <summary>
+	/// A queue of streamed tracks that are played back to back, as a single sound.
+	///
+	/// <para>
+	/// The next track is opened and decoded by the streaming workers while the current one plays,
+	/// and the audio thread switches to it on the exact frame the current one ends,
+	/// or mixes the two over the crossfade length of the next track.
+	/// Every track is decoded to the same channels and sample rate, so they can be joined without a gap.
+	/// </para>
+	///
+	/// <para>
+	/// The main thread hands the opened tracks to the audio thread and takes the finished ones back
+	/// through lock-free queues, so the audio thread never waits or allocates.
+	/// </para>
+	///
+	/// </summary>
+	class MiniaudioPlaylist
+	{
+	private:
+		/// <summary>
+		/// A track that's opened for streaming.
+		/// </summary>
+		struct Track
+		{
+			MiniaudioStream stream;
+
+			/// <summary>
+			/// Length of the crossfade from the previous track into this one, 0 for a gapless switch.
+			/// </summary>
+			uint64_t crossfadeFrames = 0;
+
+			/// <summary>
+			/// Frames of the track played so far, the silence of underruns isn't counted. Audio thread only.
+			/// </summary>
+			uint64_t framesPlayed = 0;
+		};
+
+		/// <summary>
+		/// A track that's waiting for its turn to be opened.
+		/// </summary>
+		struct QueuedTrack
+		{
+			std::string filename;
+			std::chrono::milliseconds crossfade{ 0 };
+			std::shared_ptr<const MiniaudioStreamHead> head;
+		};
+
+		/// <summary>
+		/// miniaudio data source header, must be the first member.
+		/// </summary>
+		ma_data_source_base dataSourceBase = {};
+		bool isOpen = false;
+
+		ma_uint32 channels = 0;
+		ma_uint32 sampleRate = 0;
+
+		ma_decoder_config decoderConfig = {};
+		StreamingSettings streamingSettings;
+		MiniaudioStreamScheduler* scheduler = nullptr;
+
+		// ========================
+		// Main Thread
+		// ========================
+
+		/// <summary>
+		/// Tracks that are not opened yet, in playing order.
+		/// </summary>
+		std::deque<QueuedTrack> queuedTracks;
+
+		/// <summary>
+		/// Tracks that are opened and owned by the playlist, until the audio thread gives them back.
+		/// </summary>
+		std::vector<std::unique_ptr<Track>> openTracks;
+
+		/// <summary>
+		/// Number of tracks handed to the audio thread.
+		/// </summary>
+		uint64_t tracksSent = 0;
+
+		// ========================
+		// Shared
+		// ========================
+
+		/// <summary>
+		/// Opened tracks, from the main thread to the audio thread.
+		/// </summary>
+		FranAudioShared::Containers::RingBuffer<Track*> readyTracks;
+
+		/// <summary>
+		/// Finished tracks, from the audio thread back to the main thread.
+		/// </summary>
+		FranAudioShared::Containers::RingBuffer<Track*> finishedTracks;
+
+		/// <summary>
+		/// Number of tracks that have started playing.
+		/// </summary>
+		std::atomic<uint64_t> tracksStarted = 0;
+
+		std::atomic<uint32_t> skipRequests = 0;
+		std::atomic<uint64_t> skipCrossfadeFrames = 0;
+
+		// ========================
+		// Audio Thread
+		// ========================
+
+		Track* currentTrack = nullptr;
+		Track* nextTrack = nullptr;
+
+		/// <summary>
+		/// Crossfade from the current track to the next one, in frames.
+		/// If there's no next track, the current one is faded out.
+		/// </summary>
+		uint64_t fadeLength = 0;
+		uint64_t fadePosition = 0;
+		bool isFading = false;
+
+		/// <summary>
+		/// Track that's faded in, the next track when the fade started.
+		/// </summary>
+		Track* fadeTrack = nullptr;
+
+		uint32_t skipsDone = 0;
+
+		/// <summary>
+		/// Output of the next track while crossfading.
+		/// </summary>
+		std::vector<float> mixBuffer;
+
+		/// <summary>
+		/// Open the queued tracks, keeping one ready behind the current track. Main thread only.
+		/// </summary>
+		void OpenQueuedTracks();
+
+		/// <summary>
+		/// Take the next track from the main thread if there's one. Audio thread only.
+		/// </summary>
+		void FetchNextTrack();
+
+		/// <summary>
+		/// Give the current track back and start the next one. Audio thread only.
+		/// </summary>
+		void AdvanceTrack();
+
+		/// <summary>
+		/// Start fading into the next track. Audio thread only.
+		/// </summary>
+		void StartFade(uint64_t length);
+
+		uint64_t MillisecondsToFrames(std::chrono::milliseconds length) const;
+
+		static ma_data_source_vtable dataSourceVTable;
+		static ma_result OnRead(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesReadOut);
+		static ma_result OnGetDataFormat(ma_data_source* dataSource, ma_format* format, ma_uint32* channels, ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap);
+
+	public:
+		MiniaudioPlaylist() = default;
+		MiniaudioPlaylist(const MiniaudioPlaylist&) = delete;
+		MiniaudioPlaylist& operator=(const MiniaudioPlaylist&) = delete;
+		~MiniaudioPlaylist();
+
+		/// <summary>
+		/// Initialise the playlist with no tracks.
+		/// </summary>
+		/// <param name="decoderConfig">Base decoder config, output format is overridden to 32-bit float</param>
+		/// <param name="outputChannels">Channels every track is decoded to</param>
+		/// <param name="outputSampleRate">Sample rate every track is decoded to</param>
+		/// <param name="settings">Streaming settings of the tracks</param>
+		/// <param name="scheduler">Scheduler that decodes the tracks, must outlive the playlist</param>
+		/// <returns>True if the playlist is ready to play</returns>
+		bool Open(const ma_decoder_config& decoderConfig, ma_uint32 outputChannels, ma_uint32 outputSampleRate, const StreamingSettings& settings, MiniaudioStreamScheduler* scheduler);
+
+		/// <summary>
+		/// Close every track.
+		/// The mixer must not be using the playlist anymore.
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// Add a track to the end of the playlist.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="crossfade">Length of the crossfade from the previous track, 0 for a gapless switch</param>
+		/// <param name="head">Optional decoded start of the file, only used if it's in the output format</param>
+		void Queue(const std::string& filename, std::chrono::milliseconds crossfade, std::shared_ptr<const MiniaudioStreamHead> head = nullptr);
+
+		/// <summary>
+		/// Move on to the next track now, crossfading from the current position.
+		/// </summary>
+		/// <param name="crossfade">Length of the crossfade, 0 to switch right away</param>
+		void Skip(std::chrono::milliseconds crossfade);
+
+		/// <summary>
+		/// Take the finished tracks back and open the next ones. Main thread only.
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Get the number of tracks that have started playing, including the current one.
+		/// </summary>
+		uint64_t GetTracksStarted() const;
+
+		/// <summary>
+		/// Get the miniaudio data source to play the playlist with.
+		/// </summary>
+		ma_data_source* GetDataSource();
+	};
+}
@@ -0,0 +1,650 @@
+// FranticDreamer 2022-2025
+
+#include <algorithm>
+
+#include "Stream_miniaudio.hpp"
+
+#include "FranAudioShared/Logger/Logger.hpp"
+
+namespace
+{
+	/// <summary>
+	/// Maximum number of frames decoded at once into the decode buffer.
+	/// </summary>
+	constexpr size_t DecodeChunkFrames = 4096;
+
+	size_t MillisecondsToFrames(std::chrono::milliseconds length, ma_uint32 sampleRate)
+	{
+		return static_cast<size_t>(static_cast<uint64_t>(sampleRate) * length.count() / 1000);
+	}
+}
+
+ma_data_source_vtable FranAudio::Backend::MiniaudioStream::dataSourceVTable =
+{
+	&MiniaudioStream::OnRead,
+	&MiniaudioStream::OnSeek,
+	&MiniaudioStream::OnGetDataFormat,
+	&MiniaudioStream::OnGetCursor,
+	&MiniaudioStream::OnGetLength,
+	nullptr,	// onSetLooping
+	0,			// flags
+};
+
+FranAudio::Backend::MiniaudioStream::~MiniaudioStream()
+{
+	Close();
+}
+
+void FranAudio::Backend::MiniaudioStream::Prepare(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head)
+{
+	Close();
+
+	this->filename = filename;
+	this->head = std::move(head);
+
+	// The mixer works in floats, decode straight into them
+	this->decoderConfig = decoderConfig;
+	this->decoderConfig.format = ma_format_f32;
+	this->decoderConfig.seekPointCount = settings.seekPointCount;
+
+	channels = 0;
+	sampleRate = 0;
+	lengthInFrames = 0;
+	endOfFile = false;
+	decoderFailed = false;
+	seekTarget = 0;
+	seekRequests = 0;
+	seeksDone = 0;
+	seekWriteMark = 0;
+	headCursor = 0;
+	framesRead = 0;
+	underruns = 0;
+	underrunFrames = 0;
+	reads = 0;
+	reportedUnderruns = 0;
+}
+
+bool FranAudio::Backend::MiniaudioStream::Open(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head)
+{
+	Prepare(filename, decoderConfig, settings, std::move(head));
+
+	if (this->head)
+	{
+		// Format is known from the head, the file will be opened by a streaming worker
+		channels = this->head->channels;
+		sampleRate = this->head->sampleRate;
+		lengthInFrames = this->head->lengthInFrames;
+
+		return InitDataSource(settings);
+	}
+
+	if (!OpenDecoder())
+	{
+		return false;
+	}
+
+	if (!InitDataSource(settings))
+	{
+		Close();
+		return false;
+	}
+
+	// Only the first chunk, so the mixer has something to start with. Streaming workers decode the rest.
+	DecodeAhead(DecodeChunkFrames);
+
+	return true;
+}
+
+bool FranAudio::Backend::MiniaudioStream::OpenInBackground(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head)
+{
+	if (decoderConfig.channels == 0 || decoderConfig.sampleRate == 0)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Output format must be set to open a stream in the background: " + filename);
+		return false;
+	}
+
+	Prepare(filename, decoderConfig, settings, std::move(head));
+
+	// Decoder converts to this format, so it's known before the file is opened
+	channels = this->decoderConfig.channels;
+	sampleRate = this->decoderConfig.sampleRate;
+	if (this->head)
+	{
+		lengthInFrames = this->head->lengthInFrames;
+	}
+
+	return InitDataSource(settings);
+}
+
+bool FranAudio::Backend::MiniaudioStream::OpenDecoder()
+{
+	if (ma_decoder_init_file(filename.c_str(), &decoderConfig, &decoder) != MA_SUCCESS)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to open audio file for streaming: " + filename);
+		return false;
+	}
+	hasDecoder = true;
+
+	if (head)
+	{
+		// Continue right after the head
+		if (ma_decoder_seek_to_pcm_frame(&decoder, head->frameCount) != MA_SUCCESS)
+		{
+			FranAudioShared::Logger::LogError("MiniAudio: Failed to skip the stream head: " + filename);
+			return false;
+		}
+
+		return true;
+	}
+
+	// Already known if the stream is opened in the background, and the audio thread might be reading it
+	if (channels == 0)
+	{
+		ma_decoder_get_data_format(&decoder, nullptr, &channels, &sampleRate, nullptr, 0);
+	}
+
+	ma_uint64 length = 0;
+	if (ma_decoder_get_length_in_pcm_frames(&decoder, &length) == MA_SUCCESS)
+	{
+		lengthInFrames.store(length, std::memory_order_relaxed);
+	}
+
+	return true;
+}
+
+bool FranAudio::Backend::MiniaudioStream::InitDataSource(const StreamingSettings& settings)
+{
+	if (channels == 0)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Audio file has no channels: " + filename);
+		return false;
+	}
+
+	ma_data_source_config dataSourceConfig = ma_data_source_config_init();
+	dataSourceConfig.vtable = &dataSourceVTable;
+	if (ma_data_source_init(&dataSourceConfig, &dataSourceBase) != MA_SUCCESS)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise data source for streaming: " + filename);
+		return false;
+	}
+	isOpen = true;
+
+	const size_t bufferFrames = std::max(DecodeChunkFrames, MillisecondsToFrames(settings.readAhead, sampleRate));
+	ringBuffer.Allocate(bufferFrames * channels);
+	decodeBuffer.resize(DecodeChunkFrames * channels);
+
+	// Can't wait for more space than the buffer has
+	minReadFrames = std::min(MillisecondsToFrames(settings.minReadLength, sampleRate), ringBuffer.GetCapacity() / channels / 2);
+
+	return true;
+}
+
+std::shared_ptr<FranAudio::Backend::MiniaudioStreamHead> FranAudio::Backend::MiniaudioStream::DecodeHead(const std::string& filename, const ma_decoder_config& decoderConfig, std::chrono::milliseconds length)
+{
+	ma_decoder_config config = decoderConfig;
+	config.format = ma_format_f32;
+
+	ma_decoder headDecoder;
+	if (ma_decoder_init_file(filename.c_str(), &config, &headDecoder) != MA_SUCCESS)
+	{
+		FranAudioShared::Logger::LogError("MiniAudio: Failed to open audio file for the stream head: " + filename);
+		return nullptr;
+	}
+
+	auto head = std::make_shared<MiniaudioStreamHead>();
+	ma_decoder_get_data_format(&headDecoder, nullptr, &head->channels, &head->sampleRate, nullptr, 0);
+	if (ma_decoder_get_length_in_pcm_frames(&headDecoder, &head->lengthInFrames) != MA_SUCCESS)
+	{
+		head->lengthInFrames = 0;
+	}
+
+	const size_t headFrames = MillisecondsToFrames(length, head->sampleRate);
+	head->samples.resize(headFrames * head->channels);
+	ma_decoder_read_pcm_frames(&headDecoder, head->samples.data(), headFrames, &head->frameCount);
+	head->samples.resize(static_cast<size_t>(head->frameCount) * head->channels);
+	head->samples.shrink_to_fit();
+
+	ma_decoder_uninit(&headDecoder);
+
+	return head;
+}
+
+void FranAudio::Backend::MiniaudioStream::Close()
+{
+	if (isOpen)
+	{
+		ma_data_source_uninit(&dataSourceBase);
+		isOpen = false;
+	}
+
+	if (hasDecoder)
+	{
+		ma_decoder_uninit(&decoder);
+		hasDecoder = false;
+	}
+}
+
+ma_data_source* FranAudio::Backend::MiniaudioStream::GetDataSource()
+{
+	return &dataSourceBase;
+}
+
+uint64_t FranAudio::Backend::MiniaudioStream::GetCursor() const
+{
+	return framesRead.load(std::memory_order_relaxed);
+}
+
+uint64_t FranAudio::Backend::MiniaudioStream::GetLengthInFrames() const
+{
+	return lengthInFrames.load(std::memory_order_relaxed);
+}
+
+const std::string& FranAudio::Backend::MiniaudioStream::GetFilename() const
+{
+	return filename;
+}
+
+FranAudio::Backend::StreamStats FranAudio::Backend::MiniaudioStream::GetStats() const
+{
+	StreamStats stats;
+	stats.underruns = underruns.load(std::memory_order_relaxed);
+	stats.underrunFrames = underrunFrames.load(std::memory_order_relaxed);
+	stats.reads = reads.load(std::memory_order_relaxed);
+	if (channels > 0)
+	{
+		stats.bufferedFrames = ringBuffer.GetReadable() / channels;
+		stats.capacityFrames = ringBuffer.GetCapacity() / channels;
+	}
+	return stats;
+}
+
+uint64_t FranAudio::Backend::MiniaudioStream::TakeNewUnderruns()
+{
+	const uint64_t current = underruns.load(std::memory_order_relaxed);
+	const uint64_t newUnderruns = current - reportedUnderruns;
+	reportedUnderruns = current;
+	return newUnderruns;
+}
+
+bool FranAudio::Backend::MiniaudioStream::NeedsDecode() const
+{
+	if (!isOpen)
+	{
+		return false;
+	}
+
+	if (seekRequests.load(std::memory_order_acquire) != seeksDone.load(std::memory_order_relaxed))
+	{
+		return true;
+	}
+
+	if (!hasDecoder)
+	{
+		// Playing from the head, open the file behind it
+		return !decoderFailed;
+	}
+
+	if (endOfFile.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	const size_t writableFrames = ringBuffer.GetWritable() / channels;
+	const size_t readableFrames = ringBuffer.GetReadable() / channels;
+
+	return writableFrames >= minReadFrames || readableFrames < minReadFrames;
+}
+
+double FranAudio::Backend::MiniaudioStream::GetBufferedSeconds() const
+{
+	if (channels == 0 || sampleRate == 0)
+	{
+		return 0.0;
+	}
+
+	uint64_t bufferedFrames = ringBuffer.GetReadable() / channels;
+	if (head)
+	{
+		bufferedFrames += head->frameCount - std::min<uint64_t>(head->frameCount, headCursor.load(std::memory_order_relaxed));
+	}
+
+	return static_cast<double>(bufferedFrames) / sampleRate;
+}
+
+void FranAudio::Backend::MiniaudioStream::HandleSeekRequest()
+{
+	const uint32_t requests = seekRequests.load(std::memory_order_acquire);
+	if (requests == seeksDone.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	if (hasDecoder)
+	{
+		// The head covers its own frames, the decoder continues after it
+		uint64_t target = seekTarget.load(std::memory_order_relaxed);
+		if (head)
+		{
+			target = std::max<uint64_t>(target, head->frameCount);
+		}
+
+		const bool sought = ma_decoder_seek_to_pcm_frame(&decoder, target) == MA_SUCCESS;
+		endOfFile.store(!sought, std::memory_order_relaxed);
+	}
+
+	// Everything written so far is from before the seek
+	seekWriteMark.store(ringBuffer.GetTotalWritten(), std::memory_order_relaxed);
+	seeksDone.store(requests, std::memory_order_release);
+}
+
+size_t FranAudio::Backend::MiniaudioStream::DecodeAhead(size_t maxFrames)
+{
+	if (!isOpen)
+	{
+		return 0;
+	}
+
+	if (!hasDecoder && !decoderFailed && !OpenDecoder())
+	{
+		// Play the head and stop
+		decoderFailed = true;
+		endOfFile.store(true, std::memory_order_release);
+	}
+
+	HandleSeekRequest();
+
+	if (endOfFile || !hasDecoder)
+	{
+		return 0;
+	}
+
+	reads.fetch_add(1, std::memory_order_relaxed);
+
+	size_t totalFrames = 0;
+	size_t writableFrames = std::min(ringBuffer.GetWritable() / channels, maxFrames);
+
+	while (writableFrames > 0 && !endOfFile)
+	{
+		const size_t chunkFrames = std::min(writableFrames, DecodeChunkFrames);
+
+		ma_uint64 decodedFrames = 0;
+		const ma_result result = ma_decoder_read_pcm_frames(&decoder, decodeBuffer.data(), chunkFrames, &decodedFrames);
+
+		ringBuffer.Write(decodeBuffer.data(), static_cast<size_t>(decodedFrames) * channels);
+		totalFrames += static_cast<size_t>(decodedFrames);
+		writableFrames -= static_cast<size_t>(decodedFrames);
+
+		if (result != MA_SUCCESS || decodedFrames == 0)
+		{
+			// Published after the last frames, so the reader never sees the end before them
+			endOfFile.store(true, std::memory_order_release);
+		}
+	}
+
+	return totalFrames;
+}
+
+// ========================
+// Data Source Callbacks
+// These run on the audio thread, so no locks or allocations.
+// ========================
+
+ma_result FranAudio::Backend::MiniaudioStream::OnRead(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesReadOut)
+{
+	auto* stream = reinterpret_cast<MiniaudioStream*>(dataSource);
+	auto* output = static_cast<float*>(framesOut);
+
+	const size_t requestedSamples = static_cast<size_t>(frameCount) * stream->channels;
+	size_t readSamples = 0;
+
+	const bool seekPending = stream->seekRequests.load(std::memory_order_relaxed) != stream->seeksDone.load(std::memory_order_acquire);
+	if (!seekPending)
+	{
+		// Drop the frames that were decoded before the last seek
+		const size_t totalRead = stream->ringBuffer.GetTotalRead();
+		const size_t seekWriteMark = stream->seekWriteMark.load(std::memory_order_relaxed);
+		if (totalRead < seekWriteMark)
+		{
+			stream->ringBuffer.Skip(seekWriteMark - totalRead);
+		}
+	}
+
+	// Head first, the ring buffer continues right after it
+	if (stream->head)
+	{
+		const uint64_t headCursor = stream->headCursor.load(std::memory_order_relaxed);
+		if (headCursor < stream->head->frameCount)
+		{
+			const size_t headSamples = static_cast<size_t>(std::min<uint64_t>(frameCount, stream->head->frameCount - headCursor)) * stream->channels;
+			std::copy_n(stream->head->samples.data() + headCursor * stream->channels, headSamples, output);
+			stream->headCursor.store(headCursor + headSamples / stream->channels, std::memory_order_relaxed);
+			readSamples = headSamples;
+		}
+	}
+
+	if (seekPending)
+	{
+		// Everything buffered is from before the seek, wait for the worker with silence.
+		// Cursor only counts the head frames, the decoder continues from the seek target.
+		stream->ringBuffer.Skip(stream->ringBuffer.GetReadable());
+		std::fill(output + readSamples, output + requestedSamples, 0.0f);
+
+		stream->framesRead.fetch_add(readSamples / stream->channels, std::memory_order_relaxed);
+		*framesReadOut = frameCount;
+		return MA_SUCCESS;
+	}
+
+	readSamples += stream->ringBuffer.Read(output + readSamples, requestedSamples - readSamples);
+	const ma_uint64 readFrames = readSamples / stream->channels;
+
+	// Only frames of the file move the cursor, so it doesn't run ahead of the decoder
+	stream->framesRead.fetch_add(readFrames, std::memory_order_relaxed);
+
+	if (readFrames < frameCount)
+	{
+		if (stream->endOfFile.load(std::memory_order_acquire) && stream->ringBuffer.GetReadable() == 0)
+		{
+			*framesReadOut = readFrames;
+			return readFrames == 0 ? MA_AT_END : MA_SUCCESS;
+		}
+
+		// Decoder is behind, keep the voice going with silence rather than stopping it
+		std::fill(output + readSamples, output + requestedSamples, 0.0f);
+		stream->underruns.fetch_add(1, std::memory_order_relaxed);
+		stream->underrunFrames.fetch_add(frameCount - readFrames, std::memory_order_relaxed);
+		*framesReadOut = frameCount;
+		return MA_SUCCESS;
+	}
+
+	*framesReadOut = readFrames;
+	return MA_SUCCESS;
+}
+
+ma_result FranAudio::Backend::MiniaudioStream::OnSeek(ma_data_source* dataSource, ma_uint64 frameIndex)
+{
+	auto* stream = reinterpret_cast<MiniaudioStream*>(dataSource);
+
+	const uint64_t lengthInFrames = stream->lengthInFrames.load(std::memory_order_relaxed);
+	if (lengthInFrames > 0 && frameIndex > lengthInFrames)
+	{
+		return MA_INVALID_ARGS;
+	}
+
+	if (stream->head)
+	{
+		// Seeks into the head can be played right away
+		stream->headCursor.store(std::min<uint64_t>(frameIndex, stream->head->frameCount), std::memory_order_relaxed);
+	}
+
+	stream->framesRead.store(frameIndex, std::memory_order_relaxed);
+	stream->seekTarget.store(frameIndex, std::memory_order_relaxed);
+	stream->seekRequests.fetch_add(1, std::memory_order_release);
+
+	return MA_SUCCESS;
+}
+
+ma_result FranAudio::Backend::MiniaudioStream::OnGetDataFormat(ma_data_source* dataSource, ma_format* format, ma_uint32* channels, ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap)
+{
+	auto* stream = reinterpret_cast<MiniaudioStream*>(dataSource);
+
+	*format = ma_format_f32;
+	*channels = stream->channels;
+	*sampleRate = stream->sampleRate;
+	ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, channelMapCap, stream->channels);
+
+	return MA_SUCCESS;
+}
+
+ma_result FranAudio::Backend::MiniaudioStream::OnGetCursor(ma_data_source* dataSource, ma_uint64* cursor)
+{
+	auto* stream = reinterpret_cast<MiniaudioStream*>(dataSource);
+	*cursor = stream->framesRead.load(std::memory_order_relaxed);
+	return MA_SUCCESS;
+}
+
+ma_result FranAudio::Backend::MiniaudioStream::OnGetLength(ma_data_source* dataSource, ma_uint64* length)
+{
+	auto* stream = reinterpret_cast<MiniaudioStream*>(dataSource);
+	const uint64_t lengthInFrames = stream->lengthInFrames.load(std::memory_order_relaxed);
+	if (lengthInFrames == 0)
+	{
+		return MA_NOT_IMPLEMENTED;
+	}
+
+	*length = lengthInFrames;
+	return MA_SUCCESS;
+}
+
+// ========================
+// Stream Scheduler
+// ========================
+
+FranAudio::Backend::MiniaudioStreamScheduler::~MiniaudioStreamScheduler()
+{
+	Stop();
+}
+
+void FranAudio::Backend::MiniaudioStreamScheduler::Start(const StreamingSettings& settings)
+{
+	Stop();
+
+	std::lock_guard lock(streamsMutex);
+
+	// Check the buffers a few times per minimum read, so the streams are picked soon after they have enough space
+	pollInterval = std::clamp(settings.minReadLength / 4, std::chrono::milliseconds(1), std::chrono::milliseconds(50));
+
+	stopping = false;
+	const uint32_t workerCount = std::max(1u, settings.workerThreads);
+	workers.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; i++)
+	{
+		workers.emplace_back(&MiniaudioStreamScheduler::WorkerLoop, this);
+	}
+}
+
+void FranAudio::Backend::MiniaudioStreamScheduler::Stop()
+{
+	std::vector<std::thread> stoppingWorkers;
+
+	{
+		std::lock_guard lock(streamsMutex);
+		stopping = true;
+		stoppingWorkers.swap(workers);
+	}
+	workCondition.notify_all();
+
+	for (auto& worker : stoppingWorkers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+}
+
+void FranAudio::Backend::MiniaudioStreamScheduler::Add(MiniaudioStream* stream)
+{
+	{
+		std::lock_guard lock(streamsMutex);
+		streams.push_back({ stream, false });
+	}
+	workCondition.notify_one();
+}
+
+void FranAudio::Backend::MiniaudioStreamScheduler::Remove(MiniaudioStream* stream)
+{
+	std::unique_lock lock(streamsMutex);
+
+	auto findStream = [this, stream]()
+	{
+		return std::find_if(streams.begin(), streams.end(), [stream](const ScheduledStream& scheduled) { return scheduled.stream == stream; });
+	};
+
+	// Let the worker finish its read first
+	idleCondition.wait(lock, [&]()
+	{
+		auto it = findStream();
+		return it == streams.end() || !it->busy;
+	});
+
+	auto it = findStream();
+	if (it != streams.end())
+	{
+		*it = streams.back();
+		streams.pop_back();
+	}
+}
+
+size_t FranAudio::Backend::MiniaudioStreamScheduler::PickStream() const
+{
+	size_t bestIndex = SIZE_MAX;
+	double bestBufferedSeconds = 0.0;
+
+	for (size_t i = 0; i < streams.size(); i++)
+	{
+		const auto& scheduled = streams[i];
+		if (scheduled.busy || !scheduled.stream->NeedsDecode())
+		{
+			continue;
+		}
+
+		const double bufferedSeconds = scheduled.stream->GetBufferedSeconds();
+		if (bestIndex == SIZE_MAX || bufferedSeconds < bestBufferedSeconds)
+		{
+			bestIndex = i;
+			bestBufferedSeconds = bufferedSeconds;
+		}
+	}
+
+	return bestIndex;
+}
+
+void FranAudio::Backend::MiniaudioStreamScheduler::WorkerLoop()
+{
+	std::unique_lock lock(streamsMutex);
+
+	while (!stopping)
+	{
+		const size_t index = PickStream();
+		if (index == SIZE_MAX)
+		{
+			workCondition.wait_for(lock, pollInterval);
+			continue;
+		}
+
+		// Streams can be removed while we're decoding, but not this one since it's busy
+		MiniaudioStream* stream = streams[index].stream;
+		streams[index].busy = true;
+
+		lock.unlock();
+		stream->DecodeAhead();
+		lock.lock();
+
+		auto it = std::find_if(streams.begin(), streams.end(), [stream](const ScheduledStream& scheduled) { return scheduled.stream == stream; });
+		if (it != streams.end())
+		{
+			it->busy = false;
+		}
+		idleCondition.notify_all();
+	}
+}
@@ -0,0 +1,352 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "miniaudio.h"
+
+#include "Backend/BackendTypes.hpp"
+
+#include "FranAudioShared/Containers/RingBuffer.hpp"
+
+namespace FranAudio::Backend
+{
+	/// <summary>
+	/// The decoded start of a streamed audio file, kept in memory so the stream can start without touching the disk.
+	/// Shared between the streams that are playing it.
+	/// </summary>
+	struct MiniaudioStreamHead
+	{
+		/// <summary>
+		/// Interleaved 32-bit float samples, in the file's own channels and sample rate.
+		/// </summary>
+		std::vector<float> samples;
+
+		ma_uint32 channels = 0;
+		ma_uint32 sampleRate = 0;
+
+		/// <summary>
+		/// Number of frames in samples.
+		/// </summary>
+		ma_uint64 frameCount = 0;
+
+		/// <summary>
+		/// Length of the whole file in frames, 0 if unknown.
+		/// </summary>
+		ma_uint64 lengthInFrames = 0;
+	};
+
+	/// <summary>
+	/// An audio file that's decoded from the disk while it's playing.
+	///
+	/// <para>
+	/// The streaming workers keep a small ring buffer of decoded frames ahead of the mixer,
+	/// so the memory use only depends on the read-ahead, not the file length.
+	/// The stream is a miniaudio data source, the audio thread reads the ring buffer without locking.
+	/// When the ring buffer runs dry, silence is played and the underrun is counted.
+	/// </para>
+	///
+	/// </summary>
+	class MiniaudioStream
+	{
+	private:
+		/// <summary>
+		/// miniaudio data source header, must be the first member.
+		/// </summary>
+		ma_data_source_base dataSourceBase = {};
+
+		ma_decoder decoder = {};
+		bool hasDecoder = false;
+
+		/// <summary>
+		/// Config to open the decoder with, when it's opened by a streaming worker.
+		/// </summary>
+		ma_decoder_config decoderConfig = {};
+
+		/// <summary>
+		/// Is the data source initialised? Can be true before the decoder is opened, for streams with a head.
+		/// </summary>
+		bool isOpen = false;
+
+		/// <summary>
+		/// Decoded start of the file, played before the ring buffer. Can be null.
+		/// </summary>
+		std::shared_ptr<const MiniaudioStreamHead> head;
+
+		/// <summary>
+		/// Frames of the head handed to the mixer. Audio thread only writes it.
+		/// </summary>
+		std::atomic<uint64_t> headCursor = 0;
+
+		std::string filename;
+
+		ma_uint32 channels = 0;
+		ma_uint32 sampleRate = 0;
+
+		/// <summary>
+		/// Length of the file in frames, 0 if unknown.
+		/// Written by a streaming worker when the file is opened in the background.
+		/// </summary>
+		std::atomic<uint64_t> lengthInFrames = 0;
+
+		/// <summary>
+		/// Decoded samples, written by the decoder thread and read by the audio thread.
+		/// </summary>
+		FranAudioShared::Containers::RingBuffer<float> ringBuffer;
+
+		/// <summary>
+		/// Decoder output before it's copied into the ring buffer. Decoder thread only.
+		/// </summary>
+		std::vector<float> decodeBuffer;
+
+		/// <summary>
+		/// Free space in frames that's worth a read, see StreamingSettings::minReadLength.
+		/// </summary>
+		size_t minReadFrames = 0;
+
+		std::atomic<bool> endOfFile = false;
+
+		/// <summary>
+		/// Decoder couldn't be opened by a streaming worker, only the head can be played.
+		/// </summary>
+		bool decoderFailed = false;
+
+		// ========================
+		// Seeking
+		// The audio thread requests seeks, a streaming worker seeks the decoder.
+		// Frames that are decoded before the seek are dropped by the audio thread,
+		// up to seekWriteMark, which is the ring buffer position the worker was at when it seeked.
+		// ========================
+
+		std::atomic<uint64_t> seekTarget = 0;
+		std::atomic<uint32_t> seekRequests = 0;
+		std::atomic<uint32_t> seeksDone = 0;
+		std::atomic<size_t> seekWriteMark = 0;
+
+		/// <summary>
+		/// Frames of the file handed to the mixer. The silence of underruns isn't counted.
+		/// </summary>
+		std::atomic<uint64_t> framesRead = 0;
+		std::atomic<uint64_t> underruns = 0;
+		std::atomic<uint64_t> underrunFrames = 0;
+		std::atomic<uint64_t> reads = 0;
+
+		/// <summary>
+		/// Number of underruns that are already logged. Main thread only.
+		/// </summary>
+		uint64_t reportedUnderruns = 0;
+
+		/// <summary>
+		/// Close the previous file and reset the state for a new one.
+		/// </summary>
+		void Prepare(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head);
+
+		/// <summary>
+		/// Open the decoder and skip the frames that the head covers.
+		/// </summary>
+		/// <returns>True if the decoder is opened</returns>
+		bool OpenDecoder();
+
+		/// <summary>
+		/// Seek the decoder if the audio thread asked for it. Streaming worker only.
+		/// </summary>
+		void HandleSeekRequest();
+
+		/// <summary>
+		/// Initialise the data source and allocate the buffers, once the format is known.
+		/// </summary>
+		bool InitDataSource(const StreamingSettings& settings);
+
+		static ma_data_source_vtable dataSourceVTable;
+		static ma_result OnRead(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesReadOut);
+		static ma_result OnSeek(ma_data_source* dataSource, ma_uint64 frameIndex);
+		static ma_result OnGetDataFormat(ma_data_source* dataSource, ma_format* format, ma_uint32* channels, ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap);
+		static ma_result OnGetCursor(ma_data_source* dataSource, ma_uint64* cursor);
+		static ma_result OnGetLength(ma_data_source* dataSource, ma_uint64* length);
+
+	public:
+		MiniaudioStream() = default;
+		MiniaudioStream(const MiniaudioStream&) = delete;
+		MiniaudioStream& operator=(const MiniaudioStream&) = delete;
+		~MiniaudioStream();
+
+		/// <summary>
+		/// Open an audio file and decode the first chunk of it into the ring buffer.
+		/// The rest of the read-ahead is decoded by a streaming worker once the stream is scheduled.
+		/// Opening can read through the whole file for the seek table, prefer OpenInBackground without a head.
+		/// 
+		/// <para>
+		/// If a head is given, the file isn't touched here. The stream plays the head first,
+		/// while a streaming worker opens the file and decodes the rest behind it.
+		/// </para>
+		/// 
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="decoderConfig">Base decoder config, output format is overridden to 32-bit float</param>
+		/// <param name="settings">Streaming settings for the buffer size and the read size</param>
+		/// <param name="head">Optional decoded start of the file, see DecodeHead</param>
+		/// <returns>True if the stream is ready to play</returns>
+		bool Open(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head = nullptr);
+
+		/// <summary>
+		/// Prepare an audio file for streaming without touching it, a streaming worker opens it once the stream is scheduled.
+		/// The stream plays silence, or the head, until the worker has decoded its start.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="decoderConfig">Decoder config with the output channels and sample rate set, output format is overridden to 32-bit float</param>
+		/// <param name="settings">Streaming settings for the buffer size and the read size</param>
+		/// <param name="head">Optional decoded start of the file, must be in the output channels and sample rate</param>
+		/// <returns>True if the stream is ready to be scheduled</returns>
+		bool OpenInBackground(const std::string& filename, const ma_decoder_config& decoderConfig, const StreamingSettings& settings, std::shared_ptr<const MiniaudioStreamHead> head = nullptr);
+
+		/// <summary>
+		/// Decode the start of an audio file, in the same format as the streams.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="decoderConfig">Base decoder config, output format is overridden to 32-bit float</param>
+		/// <param name="length">Length of the audio to decode</param>
+		/// <returns>Decoded head, nullptr if the file can't be decoded</returns>
+		static std::shared_ptr<MiniaudioStreamHead> DecodeHead(const std::string& filename, const ma_decoder_config& decoderConfig, std::chrono::milliseconds length);
+
+		/// <summary>
+		/// Close the file.
+		/// The mixer and the streaming workers must not be using the stream anymore.
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// Decode as many frames as the ring buffer has space for, in one go.
+		/// Only one thread may decode a stream at a time.
+		/// </summary>
+		/// <param name="maxFrames">Maximum number of frames to decode</param>
+		/// <returns>Number of frames decoded</returns>
+		size_t DecodeAhead(size_t maxFrames = SIZE_MAX);
+
+		/// <summary>
+		/// Check if the stream has enough free space to be worth decoding, or is about to run dry.
+		/// </summary>
+		bool NeedsDecode() const;
+
+		/// <summary>
+		/// Get how long the mixer can play the stream before it runs dry.
+		/// Used for deciding which stream to decode first.
+		/// </summary>
+		/// <returns>Buffered audio in seconds</returns>
+		double GetBufferedSeconds() const;
+
+		/// <summary>
+		/// Get the miniaudio data source to play the stream with.
+		/// </summary>
+		ma_data_source* GetDataSource();
+
+		/// <summary>
+		/// Get the position of the mixer in the file, the silence of underruns isn't counted.
+		/// </summary>
+		/// <returns>Cursor in frames</returns>
+		uint64_t GetCursor() const;
+
+		/// <summary>
+		/// Get the length of the streamed file.
+		/// </summary>
+		/// <returns>Length in frames, 0 if unknown or not opened yet</returns>
+		uint64_t GetLengthInFrames() const;
+
+		/// <summary>
+		/// Get the path of the streamed file.
+		/// </summary>
+		const std::string& GetFilename() const;
+
+		/// <summary>
+		/// Get the buffer and underrun statistics of the stream.
+		/// </summary>
+		StreamStats GetStats() const;
+
+		/// <summary>
+		/// Get the number of underruns since the last call. Main thread only.
+		/// </summary>
+		/// <returns>Number of new underruns</returns>
+		uint64_t TakeNewUnderruns();
+	};
+
+	/// <summary>
+	/// Decodes every active stream from a few shared worker threads.
+	///
+	/// <para>
+	/// Workers always pick the stream with the least audio buffered, so the streams that are closest
+	/// to an underrun are served first no matter how many are playing.
+	/// A stream is only picked once enough of its buffer is free, and then filled in one go,
+	/// so the reads from the disk are few and large.
+	/// </para>
+	///
+	/// </summary>
+	class MiniaudioStreamScheduler
+	{
+	private:
+		struct ScheduledStream
+		{
+			MiniaudioStream* stream = nullptr;
+
+			/// <summary>
+			/// Is a worker decoding the stream right now?
+			/// </summary>
+			bool busy = false;
+		};
+
+		std::vector<ScheduledStream> streams;
+
+		std::vector<std::thread> workers;
+		std::mutex streamsMutex;
+		std::condition_variable workCondition;
+		std::condition_variable idleCondition;
+		bool stopping = false;
+
+		/// <summary>
+		/// How long an idle worker waits before checking the buffers again.
+		/// The mixer doesn't wake the workers up, so this has to be shorter than the read-ahead.
+		/// </summary>
+		std::chrono::milliseconds pollInterval{ 10 };
+
+		void WorkerLoop();
+
+		/// <summary>
+		/// Find the stream that needs decoding the most. streamsMutex must be held.
+		/// </summary>
+		/// <returns>Index in streams, SIZE_MAX if no stream needs decoding</returns>
+		size_t PickStream() const;
+
+	public:
+		MiniaudioStreamScheduler() = default;
+		MiniaudioStreamScheduler(const MiniaudioStreamScheduler&) = delete;
+		MiniaudioStreamScheduler& operator=(const MiniaudioStreamScheduler&) = delete;
+		~MiniaudioStreamScheduler();
+
+		/// <summary>
+		/// Start the worker threads, restarting them if they're running.
+		/// </summary>
+		/// <param name="settings">Streaming settings for the number of workers and the polling rate</param>
+		void Start(const StreamingSettings& settings);
+
+		/// <summary>
+		/// Stop the worker threads. Added streams stay added.
+		/// </summary>
+		void Stop();
+
+		/// <summary>
+		/// Start decoding a stream. The stream must be opened.
+		/// </summary>
+		void Add(MiniaudioStream* stream);
+
+		/// <summary>
+		/// Stop decoding a stream.
+		/// Blocks until no worker is decoding it, so it can be closed right after.
+		/// </summary>
+		void Remove(MiniaudioStream* stream);
+	};
+}
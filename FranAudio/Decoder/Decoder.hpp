@@ -8,6 +8,7 @@
 #include <array>
 
 #include "Decoder/DecoderTypes.hpp"
+#include "Backend/BackendTypes.hpp"
 
 #include "Sound/WaveData/WaveData.hpp"
 
@@ -58,14 +59,16 @@ namespace FranAudio::Decoder
 		/// This is used to decode an audio file and store the result in the target WaveData.
 		/// 
 		/// <para>Important: Audio file MUST exist.</para>
+		/// <para>This can be called from multiple loader threads at the same time.</para>
 		/// </summary>
 		/// <returns>
 		/// True if the decoding was successful, false otherwise.
 		/// </returns>
 		/// <param name="filename">Path to an existing audio file</param>
+		/// <param name="settings">Sample rate and channel count to convert to, 0 keeps the file's own</param>
 		/// <param name="targetWaveData">Target WaveData to store the decoded audio</param>
 		/// <param name="caller">Caller backend</param>
-		virtual bool DecodeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) = 0;
+		virtual bool DecodeAudioFile(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) = 0;
 
 		/// <summary>
 		/// Gets the supported audio formats in lower case.
@@ -1,5 +1,9 @@
 // FranticDreamer 2022-2025
 
+#include <cstring>
+
+#include "miniaudio.h"
+
 #include "Decoder_libnyquist.hpp"
 
 #include "FranAudioShared/Logger/Logger.hpp"
@@ -24,12 +28,29 @@ FranAudio::Decoder::DecoderType FranAudio::Decoder::libnyquist::GetDecoderType()
 	return DecoderType::libnyquist;
 }
 
-bool FranAudio::Decoder::libnyquist::DecodeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller)
+bool FranAudio::Decoder::libnyquist::DecodeAudioFile(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller)
 {
 	nqr::AudioData audioData;
-	soundLoader.Load(&audioData, filename);
 
-	ConvertNyqDataToFranData(audioData, targetWaveData);
+	try
+	{
+		// libnyquist's buffer loader only takes a vector, copying a mapping into one costs more than its path loader
+		soundLoader.Load(&audioData, filename);
+	}
+	catch (const std::exception& e)
+	{
+		FranAudioShared::Logger::LogError(std::format("libnyquist: Failed to decode audio file {}: {}", filename, e.what()));
+		return false;
+	}
+
+	if (!ConvertNyqDataLayout(audioData, settings))
+	{
+		FranAudioShared::Logger::LogError("libnyquist: Failed to convert sample rate and channels of audio file: " + filename);
+		return false;
+	}
+
+	targetWaveData.SetFilename(filename);
+	ConvertNyqDataToFranData(std::move(audioData), targetWaveData);
 
 	return true;
 }
@@ -55,21 +76,131 @@ void FranAudio::Decoder::libnyquist::ConvertFranDataToNyqData(const FranAudio::S
 {
 	targetAudioData.channelCount = waveData.GetChannels();
 	targetAudioData.sampleRate = waveData.GetSampleRate();
-	targetAudioData.frameSize = waveData.GetFrameSize();
-	targetAudioData.samples = waveData.GetFrames();
+	targetAudioData.lengthSeconds = waveData.GetLength();
+	targetAudioData.frameSize = waveData.GetChannels() * FranAudio::Sound::WaveData::GetBytesPerSample(waveData.GetFormat()) * 8;
 	// TODO: Test the format stuff
 	targetAudioData.sourceFormat = ConvertWaveFormat(waveData.GetFormat());
+
+	// libnyquist only works with float samples
+	const size_t sampleCount = waveData.SizeInFrames() * waveData.GetChannels();
+	const auto* sampleBytes = static_cast<const uint8_t*>(waveData.GetFrameData());
+	targetAudioData.samples.resize(sampleCount);
+
+	switch (waveData.GetFormat())
+	{
+	case FranAudio::Sound::WaveFormat::IEEE_FLOAT:
+		std::memcpy(targetAudioData.samples.data(), sampleBytes, sampleCount * sizeof(float));
+		break;
+	case FranAudio::Sound::WaveFormat::PCM_16bit:
+		nqr::ConvertToFloat32(targetAudioData.samples.data(), reinterpret_cast<const int16_t*>(sampleBytes), sampleCount, nqr::PCM_16);
+		break;
+	case FranAudio::Sound::WaveFormat::PCM_32bit:
+		nqr::ConvertToFloat32(targetAudioData.samples.data(), reinterpret_cast<const int32_t*>(sampleBytes), sampleCount, nqr::PCM_32);
+		break;
+	default:
+		nqr::ConvertToFloat32(targetAudioData.samples.data(), sampleBytes, sampleCount, targetAudioData.sourceFormat);
+		break;
+	}
 }
 
-void FranAudio::Decoder::libnyquist::ConvertNyqDataToFranData(const nqr::AudioData& audioData, FranAudio::Sound::WaveData& targetWaveData)
+void FranAudio::Decoder::libnyquist::ConvertNyqDataToFranData(nqr::AudioData&& audioData, FranAudio::Sound::WaveData& targetWaveData)
 {
+	// libnyquist always decodes to float, convert back to the source format to keep the memory footprint small.
+	// 8-bit sources are stored unsigned, 64-bit float sources are stored as 32-bit float.
+	FranAudio::Sound::WaveFormat format = FranAudio::Sound::WaveFormat::IEEE_FLOAT;
+	nqr::PCMFormat storageFormat = nqr::PCM_FLT;
+
+	switch (audioData.sourceFormat)
+	{
+	case nqr::PCM_U8:
+	case nqr::PCM_S8:
+		format = FranAudio::Sound::WaveFormat::PCM_8bit;
+		storageFormat = nqr::PCM_U8;
+		break;
+	case nqr::PCM_16:
+		format = FranAudio::Sound::WaveFormat::PCM_16bit;
+		storageFormat = nqr::PCM_16;
+		break;
+	case nqr::PCM_24:
+		format = FranAudio::Sound::WaveFormat::PCM_24bit;
+		storageFormat = nqr::PCM_24;
+		break;
+	case nqr::PCM_32:
+		format = FranAudio::Sound::WaveFormat::PCM_32bit;
+		storageFormat = nqr::PCM_32;
+		break;
+	default:
+		break;
+	}
+
+	const size_t bytesPerSample = FranAudio::Sound::WaveData::GetBytesPerSample(format);
+	std::vector<uint8_t> samples(audioData.samples.size() * bytesPerSample);
+
+	if (storageFormat == nqr::PCM_FLT)
+	{
+		std::memcpy(samples.data(), audioData.samples.data(), samples.size());
+	}
+	else
+	{
+		nqr::ConvertFromFloat32(samples.data(), audioData.samples.data(), audioData.samples.size(), storageFormat);
+	}
+
+	// Don't keep the float samples around
+	std::vector<float>().swap(audioData.samples);
+
 	targetWaveData.SetChannels(audioData.channelCount);
 	targetWaveData.SetSampleRate(audioData.sampleRate);
-	targetWaveData.SetFrameSize(audioData.frameSize);
-	targetWaveData.SetFrames(audioData.samples);
-	// Format is always float in libnyquist
-	targetWaveData.SetFormat(FranAudio::Sound::WaveFormat::IEEE_FLOAT);
-	//targetWaveData.SetFormat(ConvertWaveFormat(audioData.sourceFormat));
+	targetWaveData.SetFrameSize(static_cast<unsigned char>(bytesPerSample * audioData.channelCount));
+	targetWaveData.SetLength(audioData.lengthSeconds);
+	targetWaveData.SetFormat(format);
+	targetWaveData.SetSamples(std::move(samples));
+}
+
+bool FranAudio::Decoder::libnyquist::ConvertNyqDataLayout(nqr::AudioData& audioData, const FranAudio::Backend::DecodeSettings& settings)
+{
+	const ma_uint32 inChannels = static_cast<ma_uint32>(audioData.channelCount);
+	const ma_uint32 inSampleRate = static_cast<ma_uint32>(audioData.sampleRate);
+	const ma_uint32 outChannels = settings.channels != 0 ? settings.channels : inChannels;
+	const ma_uint32 outSampleRate = settings.sampleRate != 0 ? settings.sampleRate : inSampleRate;
+
+	if (inChannels == 0 || (inChannels == outChannels && inSampleRate == outSampleRate))
+	{
+		return true;
+	}
+
+	// libnyquist has no channel-aware resampler, miniaudio's converter is used instead.
+	const ma_data_converter_config converterConfig = ma_data_converter_config_init(ma_format_f32, ma_format_f32, inChannels, outChannels, inSampleRate, outSampleRate);
+	ma_data_converter converter;
+	if (ma_data_converter_init(&converterConfig, nullptr, &converter) != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	ma_uint64 frameCountIn = audioData.samples.size() / inChannels;
+	ma_uint64 frameCountOut = 0;
+	if (ma_data_converter_get_expected_output_frame_count(&converter, frameCountIn, &frameCountOut) != MA_SUCCESS)
+	{
+		ma_data_converter_uninit(&converter, nullptr);
+		return false;
+	}
+
+	std::vector<float> converted(static_cast<size_t>(frameCountOut) * outChannels);
+	const ma_result result = ma_data_converter_process_pcm_frames(&converter, audioData.samples.data(), &frameCountIn, converted.data(), &frameCountOut);
+	ma_data_converter_uninit(&converter, nullptr);
+
+	if (result != MA_SUCCESS)
+	{
+		return false;
+	}
+
+	converted.resize(static_cast<size_t>(frameCountOut) * outChannels);
+
+	audioData.samples = std::move(converted);
+	audioData.channelCount = static_cast<int>(outChannels);
+	audioData.sampleRate = static_cast<int>(outSampleRate);
+	audioData.lengthSeconds = static_cast<double>(frameCountOut) / outSampleRate;
+
+	return true;
 }
 
 FranAudio::Sound::WaveFormat FranAudio::Decoder::libnyquist::ConvertWaveFormat(const nqr::PCMFormat& format)
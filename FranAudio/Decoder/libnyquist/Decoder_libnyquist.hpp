@@ -52,9 +52,10 @@ namespace FranAudio::Decoder
 		/// True if the decoding was successful, false otherwise.
 		/// </returns>
 		/// <param name="filename">Path to an existing audio file</param>
+		/// <param name="settings">Sample rate and channel count to convert to, 0 keeps the file's own</param>
 		/// <param name="targetWaveData">Target WaveData to store the decoded audio</param>
 		/// <param name="caller">Caller backend</param>
-		virtual bool DecodeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) override;
+		virtual bool DecodeAudioFile(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) override;
 
 		/// <summary>
 		/// Gets the supported audio formats in lower case.
@@ -64,15 +65,25 @@ namespace FranAudio::Decoder
 
 		/// <summary>
 		/// Converts the WaveData to libnyquist AudioData.
+		/// Samples are converted to float, since libnyquist only works with float samples.
 		/// </summary>
 		/// <param name="waveData">WaveData to convert into libnyquist AudioData</param>
 		static void ConvertFranDataToNyqData(const FranAudio::Sound::WaveData& waveData, nqr::AudioData& targetAudioData);
 	
 		/// <summary>
 		/// Converts the libnyquist AudioData to WaveData.
+		/// Samples are converted back to their source format, audioData is left without samples.
 		/// </summary>
 		/// <param name="audioData">libnyquist AudioData to convert into WaveData</param>
-		static void ConvertNyqDataToFranData(const nqr::AudioData& audioData, FranAudio::Sound::WaveData& targetWaveData);
+		static void ConvertNyqDataToFranData(nqr::AudioData&& audioData, FranAudio::Sound::WaveData& targetWaveData);
+
+		/// <summary>
+		/// Converts the float samples of libnyquist AudioData to another sample rate and channel count.
+		/// </summary>
+		/// <param name="audioData">libnyquist AudioData to convert in place</param>
+		/// <param name="settings">Target sample rate and channel count, 0 keeps the current one</param>
+		/// <returns>True if the samples are in the target layout</returns>
+		static bool ConvertNyqDataLayout(nqr::AudioData& audioData, const FranAudio::Backend::DecodeSettings& settings);
 	
 		static FranAudio::Sound::WaveFormat ConvertWaveFormat(const nqr::PCMFormat& format);
 
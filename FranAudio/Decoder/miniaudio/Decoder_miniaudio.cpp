@@ -13,6 +13,7 @@
 #include "Decoder_miniaudio.hpp"
 
 #include "FranAudioShared/Logger/Logger.hpp"
+#include "FranAudioShared/IO/MappedFile.hpp"
 
 bool FranAudio::Decoder::miniaudio::Init()
 {
@@ -90,7 +91,7 @@ FranAudio::Decoder::DecoderType FranAudio::Decoder::miniaudio::GetDecoderType()
 	return DecoderType::miniaudio;
 }
 
-bool FranAudio::Decoder::miniaudio::DecodeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller)
+bool FranAudio::Decoder::miniaudio::DecodeAudioFile(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller)
 {
 	ma_decoder decoder;
 	ma_decoder_config* temp = nullptr;
@@ -106,7 +107,25 @@ bool FranAudio::Decoder::miniaudio::DecodeAudioFile(const std::string& filename,
 		temp = miniAudioRef.GetDefaultDecoderConfig();
 	}
 
-	if (ma_decoder_init_file(filename.c_str(), temp, &decoder) != MA_SUCCESS)
+	// Copy, so loader threads don't write to the shared config
+	ma_decoder_config decoderConfig = *temp;
+	decoderConfig.sampleRate = settings.sampleRate;
+	decoderConfig.channels = settings.channels;
+
+	// Decode straight from the mapped file, fall back to miniaudio's own file I/O if it can't be mapped.
+	// The mapping must outlive the decoder.
+	FranAudioShared::IO::MappedFile mappedFile;
+	ma_result initResult;
+	if (mappedFile.Open(filename))
+	{
+		initResult = ma_decoder_init_memory(mappedFile.GetData(), mappedFile.GetSize(), &decoderConfig, &decoder);
+	}
+	else
+	{
+		initResult = ma_decoder_init_file(filename.c_str(), &decoderConfig, &decoder);
+	}
+
+	if (initResult != MA_SUCCESS)
 	{
 		FranAudioShared::Logger::LogError("MiniAudio: Failed to initialise decoder for file: " + filename);
 		FranAudioShared::Logger::LogError("MiniAudio: Are you sure the audio file is in a supported format?");
@@ -122,49 +141,61 @@ bool FranAudio::Decoder::miniaudio::DecodeAudioFile(const std::string& filename,
 		return false;
 	}
 
+	// Decoder config leaves the output format unset, so we get the file's native sample format.
+	// Sample rate and channels are converted by the decoder if the settings ask for it,
+	// otherwise samples are stored as they are and the mixer converts them while playing.
 	const auto channels = decoder.outputChannels;
 	const auto sampleRate = decoder.outputSampleRate;
+	const auto bytesPerFrame = static_cast<size_t>(ma_get_bytes_per_frame(decoder.outputFormat, channels));
 
 	targetWaveData.SetFilename(filename);
 	targetWaveData.SetFormat(FranAudio::Backend::miniaudio::ConvertFormat(decoder.outputFormat));
 	targetWaveData.SetLength(0.0f);
 	targetWaveData.SetChannels(channels);
 	targetWaveData.SetSampleRate(sampleRate);
-	targetWaveData.SetFrameSize(sizeof(float) * channels);
+	targetWaveData.SetFrameSize(static_cast<unsigned char>(bytesPerFrame));
+
+	auto& samples = targetWaveData.GetSamplesRef();
 
 	ma_uint64 totalFrameCount = 0;
 	if (ma_decoder_get_length_in_pcm_frames(&decoder, &totalFrameCount) == MA_SUCCESS && totalFrameCount > 0)
 	{
 		// Let's preallocate the buffer if we can get the total frame count.
-		targetWaveData.GetFramesRef().resize(static_cast<size_t>(totalFrameCount) * channels);
+		samples.resize(static_cast<size_t>(totalFrameCount) * bytesPerFrame);
 
 		ma_uint64 framesRead = 0;
-		if (ma_decoder_read_pcm_frames(&decoder, targetWaveData.GetFramesRef().data(), totalFrameCount, &framesRead) != MA_SUCCESS || framesRead == 0)
+		if (ma_decoder_read_pcm_frames(&decoder, samples.data(), totalFrameCount, &framesRead) != MA_SUCCESS || framesRead == 0)
 		{
 			FranAudioShared::Logger::LogError("MiniAudio: Failed to read audio data from file: " + filename);
 			ma_decoder_uninit(&decoder);
 			return false;
 		}
 
+		// Length might be an estimation
+		samples.resize(static_cast<size_t>(framesRead) * bytesPerFrame);
+
 		targetWaveData.SetLength(static_cast<double>(framesRead) / sampleRate);
 	}
 	else
 	{
 		// Full file read fallback (e.g., for Vorbis/Opus)
-		const size_t bufferFrames = 64u * 1024u; // 64K frames
-		std::vector<float> buffer(bufferFrames * channels);
+		// Decode straight into the sample vector chunk by chunk, instead of copying from a temporary buffer.
+		const size_t chunkFrames = 64u * 1024u; // 64K frames
 		size_t totalFrames = 0;
 
 		while (true)
 		{
+			samples.resize((totalFrames + chunkFrames) * bytesPerFrame);
+
 			ma_uint64 framesRead = 0;
-			if (ma_decoder_read_pcm_frames(&decoder, buffer.data(), bufferFrames, &framesRead) != MA_SUCCESS || framesRead == 0)
+			if (ma_decoder_read_pcm_frames(&decoder, samples.data() + (totalFrames * bytesPerFrame), chunkFrames, &framesRead) != MA_SUCCESS || framesRead == 0)
 				break;
 
 			totalFrames += static_cast<size_t>(framesRead);
-			targetWaveData.GetFramesRef().insert(targetWaveData.GetFramesRef().end(), buffer.begin(), buffer.begin() + (framesRead * channels));
 		}
 
+		samples.resize(totalFrames * bytesPerFrame);
+
 		if (totalFrames == 0)
 		{
 			FranAudioShared::Logger::LogError("MiniAudio: Failed to read audio data from file: " + filename);
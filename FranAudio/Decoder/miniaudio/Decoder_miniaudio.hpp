@@ -64,9 +64,10 @@ namespace FranAudio::Decoder
 		/// True if the decoding was successful, false otherwise.
 		/// </returns>
 		/// <param name="filename">Path to an existing audio file</param>
+		/// <param name="settings">Sample rate and channel count to convert to, 0 keeps the file's own</param>
 		/// <param name="targetWaveData">Target WaveData to store the decoded audio</param>
 		/// <param name="caller">Caller backend</param>
-		virtual bool DecodeAudioFile(const std::string& filename, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) override;
+		virtual bool DecodeAudioFile(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Sound::WaveData& targetWaveData, FranAudio::Backend::Backend& caller) override;
 
 		/// <summary>
 		/// Gets the supported audio formats in lower case.
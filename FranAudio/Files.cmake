@@ -22,9 +22,15 @@ FILE(GLOB FRANAUDIO_HEADERFILES
 	#WaveData
 	FranAudio/Sound/WaveData/WaveData.hpp
 
+	#SoundBank
+	FranAudio/SoundBank/SoundBank.hpp
+	FranAudio/SoundBank/DiskCache.hpp
+
 	#Backend
 	FranAudio/Backend/Backend.hpp
 	FranAudio/Backend/miniaudio/Backend_miniaudio.hpp
+	FranAudio/Backend/miniaudio/Stream_miniaudio.hpp
+	FranAudio/Backend/miniaudio/Playlist_miniaudio.hpp
 	#FranAudio/Backend/OpenALSoft/OpenALSoft.hpp
 
 	#Decoder
@@ -52,9 +58,15 @@ FILE(GLOB FRANAUDIO_SOURCEFILES
 	#WaveData
 	FranAudio/Sound/WaveData/WaveData.cpp
 
+	#SoundBank
+	FranAudio/SoundBank/SoundBank.cpp
+	FranAudio/SoundBank/DiskCache.cpp
+
 	#Backend
 	FranAudio/Backend/Backend.cpp
 	FranAudio/Backend/miniaudio/Backend_miniaudio.cpp
+	FranAudio/Backend/miniaudio/Stream_miniaudio.cpp
+	FranAudio/Backend/miniaudio/Playlist_miniaudio.cpp
 	#FranAudio/Backend/OpenALSoft/OpenALSoft.cpp
 
 	#Decoder
@@ -24,6 +24,14 @@ FRANAUDIO_API void FranAudio::Shutdown()
 	gGlobals.currentBackend = nullptr;
 }
 
+FRANAUDIO_API void FranAudio::Update()
+{
+	if (gGlobals.currentBackend)
+	{
+		gGlobals.currentBackend->Update();
+	}
+}
+
 FRANAUDIO_API void FranAudio::RouteLoggingToConsole(FranAudioShared::Logger::ConsoleStreamBuffer* consoleBuffer)
 {
 	FranAudioShared::Logger::RouteToConsole(consoleBuffer);
@@ -41,6 +41,12 @@ namespace FranAudio
 	/// </summary>
 	FRANAUDIO_API void Shutdown();
 
+	/// <summary>
+	/// Updates the FranAudio library.
+	/// This should be called regularly from the main thread (e.g. once per frame).
+	/// </summary>
+	FRANAUDIO_API void Update();
+
 	/// <summary>
 	/// Routes the library logging output to the specified console stream buffer.
 	/// </summary>
@@ -53,3 +53,18 @@ void FranAudio::Sound::Sound::GetPosition(float outPosition[3]) const
 {
 	FranAudio::GetBackend()->GetSoundPosition(soundID, outPosition);
 }
+
+bool FranAudio::Sound::Sound::Seek(double seconds) const
+{
+	return FranAudio::GetBackend()->SeekSound(soundID, seconds);
+}
+
+void FranAudio::Sound::Sound::SetPriority(float priority) const
+{
+	FranAudio::GetBackend()->SetSoundPriority(soundID, priority);
+}
+
+float FranAudio::Sound::Sound::GetPriority() const
+{
+	return FranAudio::GetBackend()->GetSoundPriority(soundID);
+}
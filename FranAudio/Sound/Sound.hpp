@@ -80,5 +80,24 @@ namespace FranAudio::Sound
 		/// Get the position of the sound.
 		/// </summary>
 		void GetPosition(float outPosition[3]) const;
+
+		/// <summary>
+		/// Move the playback position of the sound.
+		/// </summary>
+		/// <param name="seconds">New position from the start of the sound, in seconds</param>
+		/// <returns>True if the seek is requested</returns>
+		bool Seek(double seconds) const;
+
+		/// <summary>
+		/// Set the priority of the sound, used for choosing the sounds that are mixed.
+		/// </summary>
+		/// <param name="priority">Priority of the sound, 1.0 by default</param>
+		void SetPriority(float priority) const;
+
+		/// <summary>
+		/// Get the priority of the sound.
+		/// </summary>
+		/// <returns>Priority of the sound</returns>
+		float GetPriority() const;
 	};
 }
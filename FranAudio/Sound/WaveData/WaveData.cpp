@@ -1,10 +1,12 @@
 // FranticDreamer 2022-2025
 
 #include <algorithm>
+#include <cstring>
 
 #include "WaveData.hpp"
 
 #include "FranAudioShared/Logger/Logger.hpp"
+#include "FranAudioShared/Containers/UnorderedMap.hpp"
 
 FranAudio::Sound::WaveData::WaveData(const std::string& filename, WaveFormat format, double length, int channels, int sampleRate)
 	: filename(filename), format(format), length(length), channels(channels), sampleRate(sampleRate), frameSize(0)
@@ -66,7 +68,28 @@ int FranAudio::Sound::WaveData::GetSampleRate() const
 
 const size_t FranAudio::Sound::WaveData::SizeInFrames() const
 {
-	return framesFloat.size() / channels;
+	if (encoded || streamed)
+	{
+		return static_cast<size_t>(length * sampleRate);
+	}
+
+	const size_t bytesPerFrame = GetBytesPerSample(format) * channels;
+	if (bytesPerFrame == 0)
+	{
+		return 0;
+	}
+
+	return GetSizeInBytes() / bytesPerFrame;
+}
+
+size_t FranAudio::Sound::WaveData::GetSizeInBytes() const
+{
+	if (mappedOwner)
+	{
+		return mappedSamples.size();
+	}
+
+	return samples.size();
 }
 
 void FranAudio::Sound::WaveData::SetFrameSize(unsigned char frameSize)
@@ -79,17 +102,87 @@ unsigned char FranAudio::Sound::WaveData::GetFrameSize() const
 	return frameSize;
 }
 
-void FranAudio::Sound::WaveData::SetFrames(const std::vector<float>& frames)
+void FranAudio::Sound::WaveData::SetSamples(std::vector<uint8_t>&& samples)
+{
+	this->samples = std::move(samples);
+	mappedSamples = {};
+	mappedOwner.reset();
+	contentHash = 0;
+}
+
+void FranAudio::Sound::WaveData::SetMappedSamples(std::span<const uint8_t> samples, std::shared_ptr<const void> owner)
+{
+	std::vector<uint8_t>().swap(this->samples);
+	mappedSamples = samples;
+	mappedOwner = std::move(owner);
+	contentHash = 0;
+}
+
+bool FranAudio::Sound::WaveData::IsMapped() const
+{
+	return mappedOwner != nullptr;
+}
+
+std::vector<uint8_t>& FranAudio::Sound::WaveData::GetSamplesRef()
+{
+	return samples;
+}
+
+const void* FranAudio::Sound::WaveData::GetFrameData() const
+{
+	if (mappedOwner)
+	{
+		return mappedSamples.data();
+	}
+
+	return samples.data();
+}
+
+void FranAudio::Sound::WaveData::SetEncoded(bool encoded)
+{
+	this->encoded = encoded;
+}
+
+bool FranAudio::Sound::WaveData::IsEncoded() const
 {
-	framesFloat = frames;
+	return encoded;
 }
 
-std::vector<float>& FranAudio::Sound::WaveData::GetFramesRef()
+void FranAudio::Sound::WaveData::SetStreamed(bool streamed)
 {
-	return framesFloat;
+	this->streamed = streamed;
 }
 
-const std::vector<float>& FranAudio::Sound::WaveData::GetFrames() const
+bool FranAudio::Sound::WaveData::IsStreamed() const
 {
-	return framesFloat;
-}
\ No newline at end of file
+	return streamed;
+}
+
+uint64_t FranAudio::Sound::WaveData::ComputeContentHash()
+{
+	const auto* bytes = static_cast<const uint8_t*>(GetFrameData());
+	uint64_t hash = ankerl::unordered_dense::detail::wyhash::hash(bytes, GetSizeInBytes());
+
+	// Same bytes in a different format are different audio
+	const uint64_t layout = (static_cast<uint64_t>(format) << 56) | (static_cast<uint64_t>(encoded) << 48) | (static_cast<uint64_t>(static_cast<uint8_t>(channels)) << 32) | static_cast<uint32_t>(sampleRate);
+	hash = ankerl::unordered_dense::detail::wyhash::mix(hash, layout ^ UINT64_C(0x9E3779B97F4A7C15));
+
+	// 0 is reserved for "not computed"
+	contentHash = hash != 0 ? hash : 1;
+	return contentHash;
+}
+
+uint64_t FranAudio::Sound::WaveData::GetContentHash() const
+{
+	return contentHash;
+}
+
+bool FranAudio::Sound::WaveData::HasSameContent(const WaveData& other) const
+{
+	if (format != other.format || encoded != other.encoded || channels != other.channels || sampleRate != other.sampleRate || GetSizeInBytes() != other.GetSizeInBytes())
+	{
+		return false;
+	}
+
+	return std::memcmp(GetFrameData(), other.GetFrameData(), GetSizeInBytes()) == 0;
+}
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <span>
+#include <cstdint>
 
 namespace FranAudio::Sound
 {
@@ -37,10 +40,15 @@ namespace FranAudio::Sound
 		// Frames
 		// =========
 
-		//std::vector<uint8_t> frames8;		///<summary> Unsigned 8-bit PCM samples. </summary>
-		//std::vector<int16_t> frames16;	///<summary> Signed 16-bit PCM samples. </summary>
-		std::vector<float> framesFloat;		///<summary> Float Audio samples. </summary>
-		unsigned char frameSize;			///<summary> Bits per frame * channels. </summary>
+		std::vector<uint8_t> samples;		///<summary> Interleaved samples, stored in their source format. Or the encoded file, see encoded. </summary>
+		unsigned char frameSize;			///<summary> Bytes per sample * channels. </summary>
+		bool encoded = false;				///<summary> Are the samples the encoded file bytes, to be decoded while playing? </summary>
+		bool streamed = false;				///<summary> Is the file streamed from the disk while playing, with no samples in memory? </summary>
+
+		std::span<const uint8_t> mappedSamples;		///<summary> Samples that live in memory we don't own, like a mapped sound bank. Used instead of samples if mappedOwner is set. </summary>
+		std::shared_ptr<const void> mappedOwner;	///<summary> Keeps the memory of mappedSamples alive. </summary>
+
+		uint64_t contentHash = 0;			///<summary> Hash of the format and the samples, 0 if not computed. See ComputeContentHash. </summary>
 
 	public:
 		/// <summary>
@@ -66,37 +74,134 @@ namespace FranAudio::Sound
 
 		/// <summary>
 		/// Size in frames.
-		/// Aka: Total Frames / Channels.
+		/// Aka: Total Samples / Channels.
+		/// Estimated from the length for encoded and streamed data.
 		/// </summary>
 		[[nodiscard]] const size_t SizeInFrames() const;
 
+		/// <summary>
+		/// Size of the sample data in bytes.
+		/// </summary>
+		[[nodiscard]] size_t GetSizeInBytes() const;
+
 		/// <summary>
 		/// Set size per frame.
-		/// Aka: Bits per frame * channels.
+		/// Aka: Bytes per sample * channels.
 		/// </summary>
 		void SetFrameSize(unsigned char frameSize);
 
 		/// <summary>
 		/// Size per frame.
-		/// Aka: Bits per frame * channels.
+		/// Aka: Bytes per sample * channels.
 		/// </summary>
 		[[nodiscard]] unsigned char GetFrameSize() const;
 
 		/// <summary>
-		/// Set the frames manually.
-		/// This will set frame vector.
+		/// Set the samples manually, taking the ownership of the vector without copying.
+		/// Samples MUST be in the format of this WaveData.
+		/// </summary>
+		/// <param name="samples">Interleaved samples as raw bytes</param>
+		void SetSamples(std::vector<uint8_t>&& samples);
+
+		/// <summary>
+		/// Point the samples to memory that's owned by something else, like a mapped sound bank, without copying.
+		/// Samples MUST be in the format of this WaveData.
+		/// </summary>
+		/// <param name="samples">Interleaved samples as raw bytes</param>
+		/// <param name="owner">Owner of the memory, kept alive as long as this WaveData</param>
+		void SetMappedSamples(std::span<const uint8_t> samples, std::shared_ptr<const void> owner);
+
+		/// <summary>
+		/// Do the samples live in memory that's owned by something else?
+		/// Mapped samples are backed by a file and paged by the OS, so they don't count as resident memory.
+		/// </summary>
+		[[nodiscard]] bool IsMapped() const;
+
+		/// <summary>
+		/// Get a reference to the raw sample bytes.
+		/// Used by the decoders to fill the data in place.
+		/// </summary>
+		std::vector<uint8_t>& GetSamplesRef();
+
+		/// <summary>
+		/// Get a pointer to the first frame, in the format of this WaveData.
+		/// </summary>
+		[[nodiscard]] const void* GetFrameData() const;
+
+		/// <summary>
+		/// Set if the samples are the encoded file bytes instead of decoded PCM.
+		/// Format, channels, sample rate and length still describe the decoded audio.
+		/// </summary>
+		void SetEncoded(bool encoded);
+
+		/// <summary>
+		/// Are the samples the encoded file bytes instead of decoded PCM?
+		/// If so, GetFrameData() points to the encoded file and the data must be decoded to be played.
+		/// </summary>
+		[[nodiscard]] bool IsEncoded() const;
+
+		/// <summary>
+		/// Set if the file is streamed from the disk while playing, instead of being kept in memory.
+		/// Streamed data has no samples, format, channels, sample rate and length describe the file.
+		/// </summary>
+		void SetStreamed(bool streamed);
+
+		/// <summary>
+		/// Is the file streamed from the disk while playing?
+		/// If so, there are no samples and the filename is used to open the file.
 		/// </summary>
-		/// <param name="frames"></param>
-		void SetFrames(const std::vector<float>& frames);
+		[[nodiscard]] bool IsStreamed() const;
 
 		/// <summary>
-		/// Get a reference to frames vector.
+		/// Hash the format and the samples, and store it as the content hash.
+		/// Used for finding identical audio that's loaded from different files.
 		/// </summary>
-		std::vector<float>& GetFramesRef();
+		/// <returns>Content hash</returns>
+		uint64_t ComputeContentHash();
 
 		/// <summary>
-		/// Get frames.
+		/// Get the content hash.
 		/// </summary>
-		[[nodiscard]] const std::vector<float>& GetFrames() const;
+		/// <returns>Content hash, 0 if it's not computed</returns>
+		[[nodiscard]] uint64_t GetContentHash() const;
+
+		/// <summary>
+		/// Compare the format and the samples of two WaveData, byte by byte.
+		/// </summary>
+		/// <returns>True if both have the same audio</returns>
+		[[nodiscard]] bool HasSameContent(const WaveData& other) const;
+
+		/// <summary>
+		/// Get the size of a single sample of a format in bytes.
+		/// </summary>
+		/// <param name="format">Sample format</param>
+		/// <returns>Bytes per sample, 0 for unknown formats</returns>
+		[[nodiscard]] static constexpr size_t GetBytesPerSample(WaveFormat format)
+		{
+			switch (format)
+			{
+			case WaveFormat::PCM_8bit:
+				return 1;
+			case WaveFormat::PCM_16bit:
+				return 2;
+			case WaveFormat::PCM_24bit:
+				return 3;
+			case WaveFormat::PCM_32bit:
+			case WaveFormat::IEEE_FLOAT:
+				return 4;
+			case WaveFormat::IEEE_DOUBLE:
+				return 8;
+			default:
+				return 0;
+			}
+		}
 	};
-}
\ No newline at end of file
+
+	/// <summary>
+	/// Shared, immutable handle to decoded audio data.
+	/// 
+	/// The cache and every voice that plays the data hold one of these,
+	/// so the data is only freed after it's unloaded AND every voice using it is finished.
+	/// </summary>
+	using WaveDataPtr = std::shared_ptr<const WaveData>;
+}
@@ -0,0 +1,216 @@
+// FranticDreamer 2022-2025
+
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+#include <thread>
+#include <functional>
+
+#include "DiskCache.hpp"
+#include "SoundBank.hpp"
+
+#include "FranAudioShared/Logger/Logger.hpp"
+
+bool FranAudio::SoundBank::DiskCache::Open(const std::string& cacheDirectory, uint64_t maxCacheBytes)
+{
+	std::lock_guard lock(cacheMutex);
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(cacheDirectory, errorCode);
+	if (!std::filesystem::is_directory(cacheDirectory, errorCode))
+	{
+		FranAudioShared::Logger::LogError("DiskCache: Failed to create cache directory: " + cacheDirectory);
+		directory.clear();
+		return false;
+	}
+
+	directory = cacheDirectory;
+	maxBytes = maxCacheBytes;
+	currentBytes = 0;
+
+	for (const auto& file : std::filesystem::directory_iterator(directory, errorCode))
+	{
+		if (file.is_regular_file(errorCode) && file.path().extension() == ".fab")
+		{
+			currentBytes += file.file_size(errorCode);
+		}
+	}
+
+	PruneNoLock();
+
+	FranAudioShared::Logger::LogMessage(std::format("DiskCache: Using cache directory {} ({} bytes)", directory, currentBytes));
+
+	return true;
+}
+
+void FranAudio::SoundBank::DiskCache::Close()
+{
+	std::lock_guard lock(cacheMutex);
+	directory.clear();
+	currentBytes = 0;
+}
+
+bool FranAudio::SoundBank::DiskCache::IsOpen() const
+{
+	return !directory.empty();
+}
+
+std::string FranAudio::SoundBank::DiskCache::GetCacheFilename(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType) const
+{
+	std::error_code errorCode;
+	const auto absolutePath = std::filesystem::absolute(filename, errorCode);
+	const auto fileSize = std::filesystem::file_size(filename, errorCode);
+	if (errorCode)
+	{
+		return {};
+	}
+	const auto writeTime = std::filesystem::last_write_time(filename, errorCode);
+	if (errorCode)
+	{
+		return {};
+	}
+
+	// Any change of the file or how it's decoded gives a new key, stale files are pruned eventually
+	const std::string key = std::format("{}|{}|{}|{}|{}|{}|{}", absolutePath.generic_string(), fileSize, writeTime.time_since_epoch().count(), settings.sampleRate, settings.channels, static_cast<int>(decoderType), BankVersion);
+
+	return (std::filesystem::path(directory) / std::format("{:016x}.fab", HashName(key))).string();
+}
+
+bool FranAudio::SoundBank::DiskCache::Load(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType, FranAudio::Sound::WaveData& targetWaveData)
+{
+	if (!IsOpen())
+	{
+		return false;
+	}
+
+	const std::string cacheFilename = GetCacheFilename(filename, settings, decoderType);
+
+	std::error_code errorCode;
+	if (cacheFilename.empty() || !std::filesystem::exists(cacheFilename, errorCode))
+	{
+		return false;
+	}
+
+	// Mark as recently used, before it's mapped
+	std::filesystem::last_write_time(cacheFilename, std::filesystem::file_time_type::clock::now(), errorCode);
+
+	SoundBank bank;
+	const size_t entryIndex = bank.Open(cacheFilename) ? bank.FindEntry(filename) : SIZE_MAX;
+	if (entryIndex == SIZE_MAX || !bank.GetWaveData(entryIndex, targetWaveData))
+	{
+		FranAudioShared::Logger::LogWarning("DiskCache: Removing invalid cache file: " + cacheFilename);
+		bank.Close();
+
+		std::lock_guard lock(cacheMutex);
+		const auto fileSize = std::filesystem::file_size(cacheFilename, errorCode);
+		if (std::filesystem::remove(cacheFilename, errorCode) && !errorCode)
+		{
+			currentBytes -= std::min<uint64_t>(currentBytes, fileSize);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+bool FranAudio::SoundBank::DiskCache::Store(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType, const FranAudio::Sound::WaveData& waveData)
+{
+	if (!IsOpen() || waveData.IsMapped())
+	{
+		return false;
+	}
+
+	const std::string cacheFilename = GetCacheFilename(filename, settings, decoderType);
+	if (cacheFilename.empty())
+	{
+		return false;
+	}
+
+	// Write to a temporary file first, so a crash can't leave a half written cache file behind
+	const std::string temporaryFilename = std::format("{}.{}.tmp", cacheFilename, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+	if (!SoundBankBuilder::WriteSingleEntry(temporaryFilename, filename, waveData))
+	{
+		return false;
+	}
+
+	std::error_code errorCode;
+	const uint64_t fileSize = std::filesystem::file_size(temporaryFilename, errorCode);
+	std::filesystem::rename(temporaryFilename, cacheFilename, errorCode);
+	if (errorCode)
+	{
+		std::filesystem::remove(temporaryFilename, errorCode);
+		return false;
+	}
+
+	std::lock_guard lock(cacheMutex);
+	currentBytes += fileSize;
+	if (maxBytes > 0 && currentBytes > maxBytes)
+	{
+		PruneNoLock();
+	}
+
+	return true;
+}
+
+void FranAudio::SoundBank::DiskCache::Prune()
+{
+	std::lock_guard lock(cacheMutex);
+	PruneNoLock();
+}
+
+void FranAudio::SoundBank::DiskCache::PruneNoLock()
+{
+	if (directory.empty() || maxBytes == 0 || currentBytes <= maxBytes)
+	{
+		return;
+	}
+
+	struct CacheFile
+	{
+		std::filesystem::path path;
+		uint64_t size;
+		std::filesystem::file_time_type lastUsed;
+	};
+
+	std::error_code errorCode;
+	std::vector<CacheFile> files;
+	uint64_t totalBytes = 0;
+
+	for (const auto& file : std::filesystem::directory_iterator(directory, errorCode))
+	{
+		if (!file.is_regular_file(errorCode) || file.path().extension() != ".fab")
+		{
+			continue;
+		}
+
+		CacheFile cacheFile{ file.path(), file.file_size(errorCode), file.last_write_time(errorCode) };
+		totalBytes += cacheFile.size;
+		files.push_back(std::move(cacheFile));
+	}
+
+	// Oldest first
+	std::sort(files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) { return a.lastUsed < b.lastUsed; });
+
+	size_t removedCount = 0;
+	for (const auto& file : files)
+	{
+		if (totalBytes <= maxBytes)
+		{
+			break;
+		}
+
+		// Files that are still mapped can't be removed on some platforms, they'll be retried on the next prune
+		if (std::filesystem::remove(file.path, errorCode) && !errorCode)
+		{
+			totalBytes -= file.size;
+			removedCount++;
+		}
+	}
+
+	currentBytes = totalBytes;
+
+	if (removedCount > 0)
+	{
+		FranAudioShared::Logger::LogMessage(std::format("DiskCache: Pruned {} cache files, {} bytes left", removedCount, currentBytes));
+	}
+}
@@ -0,0 +1,98 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <cstdint>
+
+#include "Backend/BackendTypes.hpp"
+#include "Decoder/DecoderTypes.hpp"
+#include "Sound/WaveData/WaveData.hpp"
+
+namespace FranAudio::SoundBank
+{
+	/// <summary>
+	/// Persistent on-disk cache of decoded audio.
+	///
+	/// Every decoded file is written to the cache directory as a single entry sound bank,
+	/// named after a key made of its path, size, modification time and decode settings.
+	/// Later loads of the same unchanged file map the cached audio instead of decoding it again.
+	///
+	/// The directory is kept under a size limit by removing the least recently used files.
+	/// Load and Store are safe to call from multiple loader threads.
+	/// </summary>
+	class DiskCache
+	{
+	private:
+		std::string directory;
+		uint64_t maxBytes = 0;
+
+		/// <summary>
+		/// Approximate size of the cache directory, updated on stores and prunes.
+		/// </summary>
+		uint64_t currentBytes = 0;
+
+		std::mutex cacheMutex;
+
+		/// <summary>
+		/// Get the path of the cache file for an audio file.
+		/// </summary>
+		/// <returns>Path of the cache file, empty if the audio file can't be accessed</returns>
+		std::string GetCacheFilename(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType) const;
+
+		/// <summary>
+		/// Remove the least recently used cache files until the cache fits the limit. 
+		/// cacheMutex must be held.
+		/// </summary>
+		void PruneNoLock();
+
+	public:
+		DiskCache() = default;
+		DiskCache(const DiskCache&) = delete;
+		DiskCache& operator=(const DiskCache&) = delete;
+
+		/// <summary>
+		/// Start using a directory as the cache.
+		/// Creates the directory if it doesn't exist, and prunes it to the size limit.
+		/// Must not be called while loader threads are using the cache.
+		/// </summary>
+		/// <param name="cacheDirectory">Path to the cache directory</param>
+		/// <param name="maxCacheBytes">Size limit of the directory in bytes, 0 means unlimited</param>
+		/// <returns>True if the directory can be used</returns>
+		bool Open(const std::string& cacheDirectory, uint64_t maxCacheBytes);
+
+		/// <summary>
+		/// Stop using the cache. Files are kept on disk.
+		/// Must not be called while loader threads are using the cache.
+		/// </summary>
+		void Close();
+
+		[[nodiscard]] bool IsOpen() const;
+
+		/// <summary>
+		/// Load the cached audio of a file, if it's cached and the file didn't change since.
+		/// The audio is read from a mapping of the cache file.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="settings">Decode settings the audio is needed in</param>
+		/// <param name="decoderType">Decoder the audio would be decoded with</param>
+		/// <param name="targetWaveData">Target WaveData</param>
+		/// <returns>True on a cache hit</returns>
+		bool Load(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType, FranAudio::Sound::WaveData& targetWaveData);
+
+		/// <summary>
+		/// Write the decoded audio of a file to the cache.
+		/// </summary>
+		/// <param name="filename">Path to the audio file</param>
+		/// <param name="settings">Decode settings the audio was decoded with</param>
+		/// <param name="decoderType">Decoder the audio was decoded with</param>
+		/// <param name="waveData">Decoded audio</param>
+		/// <returns>True if the audio was written</returns>
+		bool Store(const std::string& filename, const FranAudio::Backend::DecodeSettings& settings, FranAudio::Decoder::DecoderType decoderType, const FranAudio::Sound::WaveData& waveData);
+
+		/// <summary>
+		/// Remove the least recently used cache files until the cache fits the limit.
+		/// </summary>
+		void Prune();
+	};
+}
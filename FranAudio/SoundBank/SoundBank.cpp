@@ -0,0 +1,271 @@
+// FranticDreamer 2022-2025
+
+#include <algorithm>
+#include <fstream>
+
+#include "SoundBank.hpp"
+
+#include "FranAudioShared/Logger/Logger.hpp"
+#include "FranAudioShared/IO/MappedFile.hpp"
+
+// ========================
+// SoundBank
+// ========================
+
+bool FranAudio::SoundBank::SoundBank::Open(const std::string& filename)
+{
+	Close();
+
+	auto mappedFile = std::make_shared<FranAudioShared::IO::MappedFile>();
+	if (!mappedFile->Open(filename))
+	{
+		FranAudioShared::Logger::LogError("SoundBank: Failed to open sound bank: " + filename);
+		return false;
+	}
+
+	const uint8_t* base = mappedFile->GetData();
+	const size_t size = mappedFile->GetSize();
+
+	if (size < sizeof(BankHeader))
+	{
+		FranAudioShared::Logger::LogError("SoundBank: File is too small to be a sound bank: " + filename);
+		return false;
+	}
+
+	const auto* header = reinterpret_cast<const BankHeader*>(base);
+	if (header->magic != BankMagic || header->version != BankVersion)
+	{
+		FranAudioShared::Logger::LogError(std::format("SoundBank: Not a sound bank, or an unsupported version ({}): {}", header->version, filename));
+		return false;
+	}
+
+	const uint64_t entriesEnd = sizeof(BankHeader) + static_cast<uint64_t>(header->entryCount) * sizeof(BankEntry);
+	// Subtracting instead of adding, so crafted offsets can't wrap around
+	if (entriesEnd > size || header->namesOffset < entriesEnd || header->namesSize > size - header->namesOffset)
+	{
+		FranAudioShared::Logger::LogError("SoundBank: Sound bank is truncated: " + filename);
+		return false;
+	}
+
+	std::span<const BankEntry> bankEntries(reinterpret_cast<const BankEntry*>(base + sizeof(BankHeader)), header->entryCount);
+	for (const auto& entry : bankEntries)
+	{
+		if (entry.dataOffset > size || entry.dataSize > size - entry.dataOffset || static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header->namesSize)
+		{
+			FranAudioShared::Logger::LogError("SoundBank: Sound bank has an entry out of bounds: " + filename);
+			return false;
+		}
+
+		// Frame size is stored in a byte
+		const auto format = static_cast<FranAudio::Sound::WaveFormat>(entry.format);
+		const size_t frameSize = FranAudio::Sound::WaveData::GetBytesPerSample(format) * entry.channels;
+		if (format == FranAudio::Sound::WaveFormat::Unknown || entry.format > static_cast<uint8_t>(FranAudio::Sound::WaveFormat::IEEE_DOUBLE) ||
+			entry.channels == 0 || frameSize > UINT8_MAX || entry.sampleRate == 0 || entry.sampleRate > BankMaxSampleRate)
+		{
+			FranAudioShared::Logger::LogError(std::format("SoundBank: Sound bank has an entry with an invalid format ({} channels, {} Hz, format {}): {}", entry.channels, entry.sampleRate, entry.format, filename));
+			return false;
+		}
+	}
+
+	entries = bankEntries;
+	names = std::string_view(reinterpret_cast<const char*>(base + header->namesOffset), static_cast<size_t>(header->namesSize));
+	file = std::move(mappedFile);
+
+	return true;
+}
+
+void FranAudio::SoundBank::SoundBank::Close()
+{
+	file.reset();
+	entries = {};
+	names = {};
+}
+
+bool FranAudio::SoundBank::SoundBank::IsOpen() const
+{
+	return file != nullptr;
+}
+
+size_t FranAudio::SoundBank::SoundBank::GetEntryCount() const
+{
+	return entries.size();
+}
+
+std::string_view FranAudio::SoundBank::SoundBank::GetEntryName(size_t index) const
+{
+	if (index >= entries.size())
+	{
+		return {};
+	}
+
+	return names.substr(entries[index].nameOffset, entries[index].nameLength);
+}
+
+size_t FranAudio::SoundBank::SoundBank::FindEntry(std::string_view name) const
+{
+	const uint64_t hash = HashName(name);
+
+	auto it = std::lower_bound(entries.begin(), entries.end(), hash, [](const BankEntry& entry, uint64_t value) { return entry.nameHash < value; });
+
+	// Check the names too, in case of a hash collision
+	for (; it != entries.end() && it->nameHash == hash; ++it)
+	{
+		const size_t index = static_cast<size_t>(it - entries.begin());
+		if (GetEntryName(index) == name)
+		{
+			return index;
+		}
+	}
+
+	return SIZE_MAX;
+}
+
+bool FranAudio::SoundBank::SoundBank::GetWaveData(size_t index, FranAudio::Sound::WaveData& targetWaveData) const
+{
+	if (index >= entries.size())
+	{
+		return false;
+	}
+
+	const auto& entry = entries[index];
+	const auto format = static_cast<FranAudio::Sound::WaveFormat>(entry.format);
+
+	targetWaveData.SetFilename(std::string(GetEntryName(index)));
+	targetWaveData.SetFormat(format);
+	targetWaveData.SetChannels(static_cast<char>(entry.channels));
+	targetWaveData.SetSampleRate(static_cast<int>(entry.sampleRate));
+	targetWaveData.SetLength(entry.sampleRate > 0 ? static_cast<double>(entry.frameCount) / entry.sampleRate : 0.0);
+	targetWaveData.SetFrameSize(static_cast<unsigned char>(FranAudio::Sound::WaveData::GetBytesPerSample(format) * entry.channels));
+	targetWaveData.SetEncoded((entry.flags & BankEntryFlags_Encoded) != 0);
+	targetWaveData.SetMappedSamples(file->GetSpan().subspan(static_cast<size_t>(entry.dataOffset), static_cast<size_t>(entry.dataSize)), file);
+
+	return true;
+}
+
+// ========================
+// SoundBankBuilder
+// ========================
+
+bool FranAudio::SoundBank::SoundBankBuilder::AddEntry(const std::string& name, FranAudio::Sound::WaveDataPtr waveData)
+{
+	// Streamed files have no samples to bake
+	if (!waveData || waveData->IsStreamed())
+	{
+		return false;
+	}
+
+	for (const auto& entry : entries)
+	{
+		if (entry.name == name)
+		{
+			return false;
+		}
+	}
+
+	entries.emplace_back(name, std::move(waveData));
+	return true;
+}
+
+size_t FranAudio::SoundBank::SoundBankBuilder::GetEntryCount() const
+{
+	return entries.size();
+}
+
+bool FranAudio::SoundBank::SoundBankBuilder::Write(const std::string& filename) const
+{
+	std::vector<std::pair<std::string_view, const FranAudio::Sound::WaveData*>> bankEntries;
+	bankEntries.reserve(entries.size());
+	for (const auto& entry : entries)
+	{
+		bankEntries.emplace_back(entry.name, entry.waveData.get());
+	}
+
+	const uint64_t bankSize = WriteBank(filename, bankEntries);
+	if (bankSize == 0)
+	{
+		return false;
+	}
+
+	FranAudioShared::Logger::LogSuccess(std::format("SoundBank: Wrote {} entries ({} bytes) to sound bank: {}", bankEntries.size(), bankSize, filename));
+
+	return true;
+}
+
+bool FranAudio::SoundBank::SoundBankBuilder::WriteSingleEntry(const std::string& filename, std::string_view name, const FranAudio::Sound::WaveData& waveData)
+{
+	std::vector<std::pair<std::string_view, const FranAudio::Sound::WaveData*>> bankEntries;
+	bankEntries.emplace_back(name, &waveData);
+
+	return WriteBank(filename, bankEntries) != 0;
+}
+
+uint64_t FranAudio::SoundBank::SoundBankBuilder::WriteBank(const std::string& filename, std::vector<std::pair<std::string_view, const FranAudio::Sound::WaveData*>>& bankEntries)
+{
+	auto alignUp = [](uint64_t value) { return (value + BankDataAlignment - 1) & ~(BankDataAlignment - 1); };
+
+	// Sorted by hash, so the runtime can binary search
+	std::stable_sort(bankEntries.begin(), bankEntries.end(), [](const auto& a, const auto& b) { return HashName(a.first) < HashName(b.first); });
+
+	BankHeader header;
+	header.entryCount = static_cast<uint32_t>(bankEntries.size());
+	header.namesOffset = sizeof(BankHeader) + bankEntries.size() * sizeof(BankEntry);
+
+	std::string namesBlob;
+	std::vector<BankEntry> headerEntries;
+	headerEntries.reserve(bankEntries.size());
+
+	for (const auto& [name, waveData] : bankEntries)
+	{
+		BankEntry entry;
+		entry.nameHash = HashName(name);
+		entry.nameOffset = static_cast<uint32_t>(namesBlob.size());
+		entry.nameLength = static_cast<uint32_t>(name.size());
+		entry.dataSize = waveData->GetSizeInBytes();
+		entry.frameCount = waveData->SizeInFrames();
+		entry.sampleRate = static_cast<uint32_t>(waveData->GetSampleRate());
+		entry.channels = static_cast<uint16_t>(waveData->GetChannels());
+		entry.format = static_cast<uint8_t>(waveData->GetFormat());
+		entry.flags = waveData->IsEncoded() ? BankEntryFlags_Encoded : BankEntryFlags_None;
+
+		namesBlob += name;
+		headerEntries.push_back(entry);
+	}
+
+	header.namesSize = namesBlob.size();
+
+	uint64_t dataOffset = alignUp(header.namesOffset + header.namesSize);
+	for (auto& entry : headerEntries)
+	{
+		entry.dataOffset = dataOffset;
+		dataOffset = alignUp(dataOffset + entry.dataSize);
+	}
+
+	std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+	if (!output.is_open())
+	{
+		FranAudioShared::Logger::LogError("SoundBank: Failed to create sound bank: " + filename);
+		return 0;
+	}
+
+	output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	output.write(reinterpret_cast<const char*>(headerEntries.data()), headerEntries.size() * sizeof(BankEntry));
+	output.write(namesBlob.data(), namesBlob.size());
+
+	static constexpr char padding[BankDataAlignment] = {};
+	uint64_t position = header.namesOffset + header.namesSize;
+
+	for (size_t i = 0; i < headerEntries.size(); i++)
+	{
+		output.write(padding, static_cast<std::streamsize>(headerEntries[i].dataOffset - position));
+		output.write(static_cast<const char*>(bankEntries[i].second->GetFrameData()), static_cast<std::streamsize>(headerEntries[i].dataSize));
+		position = headerEntries[i].dataOffset + headerEntries[i].dataSize;
+	}
+
+	if (!output)
+	{
+		FranAudioShared::Logger::LogError("SoundBank: Failed to write sound bank: " + filename);
+		return 0;
+	}
+
+	return position;
+}
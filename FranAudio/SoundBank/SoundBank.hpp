@@ -0,0 +1,197 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <memory>
+#include <utility>
+#include <cstdint>
+
+#include "Sound/WaveData/WaveData.hpp"
+
+namespace FranAudioShared::IO
+{
+	class MappedFile;
+}
+
+namespace FranAudio::SoundBank
+{
+	// ========================
+	// File Format
+	// ========================
+	//
+	// A sound bank is a single little-endian file laid out as:
+	//
+	//   BankHeader
+	//   BankEntry[entryCount]		(sorted by name hash)
+	//   Names						(entry names, not null terminated)
+	//   Audio data					(every entry aligned to BankDataAlignment)
+	//
+	// Audio data is either decoded PCM in the entry's format, or the encoded file bytes.
+
+	inline constexpr uint32_t BankMagic = 0x4B424146; // "FABK"
+	inline constexpr uint32_t BankVersion = 1;
+	inline constexpr uint64_t BankDataAlignment = 64;
+
+	/// <summary>
+	/// Largest sample rate an entry can have, anything above is treated as a corrupt bank.
+	/// </summary>
+	inline constexpr uint32_t BankMaxSampleRate = 384000;
+
+	/// <summary>
+	/// Flags of a sound bank entry.
+	/// </summary>
+	enum BankEntryFlags : uint8_t
+	{
+		BankEntryFlags_None = 0,
+		BankEntryFlags_Encoded = 1 << 0,	///<summary> Data is the encoded file, to be decoded while playing. </summary>
+	};
+
+	struct BankHeader
+	{
+		uint32_t magic = BankMagic;
+		uint32_t version = BankVersion;
+		uint32_t entryCount = 0;
+		uint32_t dataAlignment = BankDataAlignment;
+		uint64_t namesOffset = 0;
+		uint64_t namesSize = 0;
+	};
+
+	struct BankEntry
+	{
+		uint64_t nameHash = 0;
+		uint64_t dataOffset = 0;	///<summary> From the start of the file. </summary>
+		uint64_t dataSize = 0;
+		uint64_t frameCount = 0;
+		uint32_t nameOffset = 0;	///<summary> From the start of the names. </summary>
+		uint32_t nameLength = 0;
+		uint32_t sampleRate = 0;
+		uint16_t channels = 0;
+		uint8_t format = 0;			///<summary> FranAudio::Sound::WaveFormat </summary>
+		uint8_t flags = BankEntryFlags_None;
+	};
+
+	static_assert(sizeof(BankHeader) == 32, "Sound bank header layout changed");
+	static_assert(sizeof(BankEntry) == 48, "Sound bank entry layout changed");
+
+	/// <summary>
+	/// Hash of an entry name, stored in the bank for lookups.
+	/// 64-bit FNV-1a, so it's stable across platforms and builds.
+	/// </summary>
+	/// <param name="name">Entry name, usually the path of the source audio file</param>
+	/// <returns>Name hash</returns>
+	[[nodiscard]] constexpr uint64_t HashName(std::string_view name)
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
+		for (const char c : name)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 0x100000001b3ull;
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// A memory-mapped sound bank.
+	///
+	/// Entries are read in place from the mapping, so loading a bank doesn't decode or copy any audio.
+	/// WaveData made from the bank keeps the mapping alive, so the bank can be closed while its entries are in use.
+	/// </summary>
+	class SoundBank
+	{
+	private:
+		std::shared_ptr<FranAudioShared::IO::MappedFile> file;
+		std::span<const BankEntry> entries;
+		std::string_view names;
+
+	public:
+		/// <summary>
+		/// Map and validate a sound bank file.
+		/// </summary>
+		/// <param name="filename">Path to the sound bank</param>
+		/// <returns>True if the bank is valid</returns>
+		bool Open(const std::string& filename);
+
+		/// <summary>
+		/// Release this object's reference to the bank.
+		/// </summary>
+		void Close();
+
+		[[nodiscard]] bool IsOpen() const;
+
+		[[nodiscard]] size_t GetEntryCount() const;
+
+		/// <summary>
+		/// Get the name of an entry.
+		/// Points into the mapping, valid while the bank is open.
+		/// </summary>
+		[[nodiscard]] std::string_view GetEntryName(size_t index) const;
+
+		/// <summary>
+		/// Find an entry by its name.
+		/// </summary>
+		/// <param name="name">Entry name</param>
+		/// <returns>Entry index, SIZE_MAX if not found</returns>
+		[[nodiscard]] size_t FindEntry(std::string_view name) const;
+
+		/// <summary>
+		/// Make a WaveData that reads an entry's audio straight from the mapping.
+		/// </summary>
+		/// <param name="index">Entry index</param>
+		/// <param name="targetWaveData">Target WaveData</param>
+		/// <returns>True if the entry is valid</returns>
+		bool GetWaveData(size_t index, FranAudio::Sound::WaveData& targetWaveData) const;
+	};
+
+	/// <summary>
+	/// Builds sound bank files from loaded audio data.
+	/// Used by the offline bank builder tool.
+	/// </summary>
+	class SoundBankBuilder
+	{
+	private:
+		struct PendingEntry
+		{
+			std::string name;
+			FranAudio::Sound::WaveDataPtr waveData;
+		};
+
+		std::vector<PendingEntry> entries;
+
+	public:
+		/// <summary>
+		/// Add audio data to the bank.
+		/// </summary>
+		/// <param name="name">Entry name, the filename it will be played with</param>
+		/// <param name="waveData">Decoded or encoded audio data</param>
+		/// <returns>True if the entry was added, false if the name is already in the bank</returns>
+		bool AddEntry(const std::string& name, FranAudio::Sound::WaveDataPtr waveData);
+
+		[[nodiscard]] size_t GetEntryCount() const;
+
+		/// <summary>
+		/// Write every added entry to a bank file.
+		/// </summary>
+		/// <param name="filename">Path to the output bank file</param>
+		/// <returns>True if the bank was written</returns>
+		bool Write(const std::string& filename) const;
+
+		/// <summary>
+		/// Write a bank with a single entry, without keeping a reference to the audio data.
+		/// </summary>
+		/// <param name="filename">Path to the output bank file</param>
+		/// <param name="name">Entry name</param>
+		/// <param name="waveData">Decoded or encoded audio data</param>
+		/// <returns>True if the bank was written</returns>
+		static bool WriteSingleEntry(const std::string& filename, std::string_view name, const FranAudio::Sound::WaveData& waveData);
+
+	private:
+		/// <summary>
+		/// Write the given entries to a bank file.
+		/// </summary>
+		/// <returns>Size of the written bank in bytes, 0 on failure</returns>
+		static uint64_t WriteBank(const std::string& filename, std::vector<std::pair<std::string_view, const FranAudio::Sound::WaveData*>>& bankEntries);
+	};
+}
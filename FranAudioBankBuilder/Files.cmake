@@ -0,0 +1,12 @@
+# FranticDreamer 2022-2025
+
+# ---
+# FranAudio Sound Bank Builder Files
+# ---
+
+# Source files
+FILE(GLOB FRANAUDIOBANKBUILDER_SOURCEFILES
+
+	#Main
+	FranAudioBankBuilder/FranAudioBankBuilder.cpp
+	)
@@ -0,0 +1,143 @@
+// FranticDreamer 2022-2025
+
+// FranAudio Sound Bank Builder =======================================================
+//
+//
+// Offline tool that decodes a set of audio files once and bakes them into a single
+// sound bank file. The bank is memory-mapped at runtime by Backend::LoadSoundBank,
+// so the files are ready to play without decoding anything at startup.
+//
+// Usage:
+//   FranAudioBankBuilder -o <output bank> [options] <audio files...>
+//
+// Options:
+//   -o, --output <file>		Output sound bank
+//   -m, --manifest <file>		Add every file in a manifest (one path per line, '#' for comments)
+//   --compressed				Keep the files encoded, they'll be decoded while playing
+//   --resample					Convert the files to the engine's sample rate and channels
+//
+// Entry names are the paths as they are given, so play them with the same paths.
+//
+//
+// ====================================================================================
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "FranAudio.hpp"
+#include "SoundBank/SoundBank.hpp"
+
+#include "FranAudioShared/Logger/Logger.hpp"
+
+static void PrintUsage()
+{
+	std::cout << "Usage: FranAudioBankBuilder -o <output bank> [-m <manifest>] [--compressed] [--resample] <audio files...>" << std::endl;
+}
+
+static bool ReadManifest(const std::string& manifestFilename, std::vector<std::string>& outFilenames)
+{
+	std::ifstream manifest(manifestFilename);
+	if (!manifest.is_open())
+	{
+		FranAudioShared::Logger::LogError("Failed to open manifest: " + manifestFilename);
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(manifest, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		if (line.empty() || line.front() == '#')
+		{
+			continue;
+		}
+
+		outFilenames.push_back(line);
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string outputFilename;
+	std::vector<std::string> inputFilenames;
+	FranAudio::Backend::AssetLoadOptions loadOptions;
+	loadOptions.residency = FranAudio::Backend::ResidencyMode::Decoded;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string argument = argv[i];
+
+		if ((argument == "-o" || argument == "--output") && i + 1 < argc)
+		{
+			outputFilename = argv[++i];
+		}
+		else if ((argument == "-m" || argument == "--manifest") && i + 1 < argc)
+		{
+			if (!ReadManifest(argv[++i], inputFilenames))
+			{
+				return 1;
+			}
+		}
+		else if (argument == "--compressed")
+		{
+			loadOptions.residency = FranAudio::Backend::ResidencyMode::Compressed;
+		}
+		else if (argument == "--resample")
+		{
+			loadOptions.resampleToEngine = true;
+		}
+		else if (!argument.empty() && argument.front() == '-')
+		{
+			PrintUsage();
+			return 1;
+		}
+		else
+		{
+			inputFilenames.push_back(argument);
+		}
+	}
+
+	if (outputFilename.empty() || inputFilenames.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	FranAudio::Init();
+	auto* backend = FranAudio::GetBackend();
+	backend->SetDefaultLoadOptions(loadOptions);
+
+	const auto assetIDs = backend->LoadAudioFiles(inputFilenames);
+
+	FranAudio::SoundBank::SoundBankBuilder builder;
+	size_t failedCount = 0;
+	for (size_t i = 0; i < inputFilenames.size(); i++)
+	{
+		if (assetIDs[i] == FranAudio::Backend::InvalidAssetID)
+		{
+			failedCount++;
+			continue;
+		}
+
+		builder.AddEntry(inputFilenames[i], backend->GetWaveData(assetIDs[i]));
+	}
+
+	const bool written = builder.GetEntryCount() > 0 && builder.Write(outputFilename);
+
+	FranAudio::Shutdown();
+
+	if (failedCount > 0)
+	{
+		FranAudioShared::Logger::LogError(std::format("{} audio files failed to load, they're not in the bank", failedCount));
+	}
+
+	return (written && failedCount == 0) ? 0 : 1;
+}
@@ -180,7 +180,7 @@ namespace FranAudioClient::Wrapper
 		// Audio File Management
 		// ========================
 
-		FRANAUDIO_CLIENT_API size_t LoadAudioFile(const std::string& filename)
+		FRANAUDIO_CLIENT_API FranAudio::Backend::AssetID LoadAudioFile(const std::string& filename)
 		{
 			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-load_audio_file", { filename }));
 			try
@@ -190,10 +190,105 @@ namespace FranAudioClient::Wrapper
 			catch (const std::exception& e)
 			{
 				FranAudioShared::Logger::LogError("Failed to load audio file: " + filename);
+				return FranAudio::Backend::InvalidAssetID;
+			}
+		}
+
+		FRANAUDIO_CLIENT_API const std::vector<FranAudio::Backend::AssetID> LoadAudioManifest(const std::string& manifestFilename)
+		{
+			std::string response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-load_audio_manifest", { manifestFilename }));
+			return FranAudioShared::Serialisation::BinarySerialiser::DeserialiseVector<FranAudio::Backend::AssetID>(response);
+		}
+
+		FRANAUDIO_CLIENT_API size_t LoadSoundBank(const std::string& bankFilename)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-load_sound_bank", { bankFilename }));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to load sound bank on server!");
 				return SIZE_MAX;
 			}
 		}
 
+		FRANAUDIO_CLIENT_API bool UnloadAudioFile(const std::string& filename)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-unload_audio_file", { filename }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API void SetMemoryBudget(size_t budgetBytes)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_memory_budget", { std::to_string(budgetBytes) }));
+		}
+
+		FRANAUDIO_CLIENT_API void SetAssetLoadOptions(const std::string& filename, FranAudio::Backend::ResidencyMode residency, uint64_t compressedThreshold, bool resampleToEngine, uint64_t streamThreshold)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_asset_load_options", { filename, std::to_string((int)residency), std::to_string(compressedThreshold), resampleToEngine ? "1" : "0", std::to_string(streamThreshold) }));
+		}
+
+		FRANAUDIO_CLIENT_API bool SetDiskCache(const std::string& directory, uint64_t maxBytes)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_disk_cache", { directory, std::to_string(maxBytes) }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API size_t GetResidentBytes()
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-get_resident_bytes", {}));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to get resident bytes from server!");
+				return 0;
+			}
+		}
+
+		FRANAUDIO_CLIENT_API size_t GetDeduplicatedBytes()
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-get_deduplicated_bytes", {}));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to get deduplicated bytes from server!");
+				return 0;
+			}
+		}
+
+		FRANAUDIO_CLIENT_API void SetMaxPlayLatency(size_t latencyMilliseconds)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_max_play_latency", { std::to_string(latencyMilliseconds) }));
+		}
+
+		FRANAUDIO_CLIENT_API void SetMaxRealVoices(size_t maxVoices)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_max_real_voices", { std::to_string(maxVoices) }));
+		}
+
+		FRANAUDIO_CLIENT_API void SetInstanceLimit(const std::string& filename, size_t maxInstances, FranAudio::Backend::VoiceStealPolicy policy)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_instance_limit", { filename, std::to_string(maxInstances), std::to_string(static_cast<int>(policy)) }));
+		}
+
+		FRANAUDIO_CLIENT_API void SetInstanceGroup(const std::string& filename, const std::string& group)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_instance_group", { filename, group }));
+		}
+
+		FRANAUDIO_CLIENT_API void SetGroupInstanceLimit(const std::string& group, size_t maxInstances, FranAudio::Backend::VoiceStealPolicy policy)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_group_instance_limit", { group, std::to_string(maxInstances), std::to_string(static_cast<int>(policy)) }));
+		}
+
 		FRANAUDIO_CLIENT_API size_t PlayAudioFile(const std::string& filename)
 		{
 			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-play_audio_file", { filename }));
@@ -208,6 +303,34 @@ namespace FranAudioClient::Wrapper
 			}
 		}
 
+		FRANAUDIO_CLIENT_API FranAudio::Backend::AssetID GetAssetID(const std::string& filename)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-get_asset_id", { filename }));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to get asset ID: " + filename);
+				return FranAudio::Backend::InvalidAssetID;
+			}
+		}
+
+		FRANAUDIO_CLIENT_API size_t PlayAudioAsset(FranAudio::Backend::AssetID assetID)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-play_audio_asset", { std::to_string(assetID) }));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to play audio asset: " + std::to_string(assetID));
+				return SIZE_MAX;
+			}
+		}
+
 		FRANAUDIO_CLIENT_API size_t PlayAudioFileNoChecks(const std::string& filename)
 		{
 			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-play_audio_file_no_checks", { filename }));
@@ -240,6 +363,72 @@ namespace FranAudioClient::Wrapper
 		// Macro Sound Management
 		// ========================
 
+		FRANAUDIO_CLIENT_API bool LoadStreamHead(const std::string& filename, size_t lengthMilliseconds)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-load_stream_head", { filename, std::to_string(lengthMilliseconds) }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API bool UnloadStreamHead(const std::string& filename)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-unload_stream_head", { filename }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API void SetStreamingSettings(uint32_t workerThreads, size_t readAheadMilliseconds, size_t minReadMilliseconds)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-set_streaming_settings", { std::to_string(workerThreads), std::to_string(readAheadMilliseconds), std::to_string(minReadMilliseconds) }));
+		}
+
+		FRANAUDIO_CLIENT_API FranAudio::Backend::StreamStats GetStreamStats(size_t soundID)
+		{
+			std::string response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-get_stream_stats", { std::to_string(soundID) }));
+			const auto values = FranAudioShared::Serialisation::BinarySerialiser::DeserialiseVector<uint64_t>(response);
+
+			FranAudio::Backend::StreamStats stats;
+			if (values.size() < 5)
+			{
+				FranAudioShared::Logger::LogError("Failed to get stream stats from server!");
+				return stats;
+			}
+
+			stats.underruns = values[0];
+			stats.underrunFrames = values[1];
+			stats.bufferedFrames = values[2];
+			stats.capacityFrames = values[3];
+			stats.reads = values[4];
+			return stats;
+		}
+
+		FRANAUDIO_CLIENT_API size_t PlayPlaylist(const std::vector<std::string>& filenames, size_t crossfadeMilliseconds)
+		{
+			std::vector<std::string> params = { std::to_string(crossfadeMilliseconds) };
+			params.insert(params.end(), filenames.begin(), filenames.end());
+
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-play_playlist", params));
+			try
+			{
+				return std::stoull(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to play playlist!");
+				return SIZE_MAX;
+			}
+		}
+
+		FRANAUDIO_CLIENT_API bool QueuePlaylistTrack(size_t soundID, const std::string& filename, size_t crossfadeMilliseconds)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-queue_playlist_track", { std::to_string(soundID), filename, std::to_string(crossfadeMilliseconds) }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API bool SkipPlaylistTrack(size_t soundID, size_t crossfadeMilliseconds)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-skip_playlist_track", { std::to_string(soundID), std::to_string(crossfadeMilliseconds) }));
+			return response == "1";
+		}
+
 		FRANAUDIO_CLIENT_API const std::vector<size_t> GetActiveSoundIDs()
 		{
 			std::string response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("backend-get_active_sound_ids", {}));
@@ -309,5 +498,30 @@ namespace FranAudioClient::Wrapper
 				return;
 			}
 		}
+
+		FRANAUDIO_CLIENT_API bool Seek(size_t soundIndex, double seconds)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("sound-seek", { std::to_string(soundIndex), std::to_string(seconds) }));
+			return response == "1";
+		}
+
+		FRANAUDIO_CLIENT_API void SetPriority(size_t soundIndex, float priority)
+		{
+			FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("sound-set_priority", { std::to_string(soundIndex), std::to_string(priority) }));
+		}
+
+		FRANAUDIO_CLIENT_API float GetPriority(size_t soundIndex)
+		{
+			auto response = FranAudioClient::Send(FranAudioShared::Network::NetworkFunction("sound-get_priority", { std::to_string(soundIndex) }));
+			try
+			{
+				return std::stof(response);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError("Failed to get priority for sound index: " + std::to_string(soundIndex));
+				return 0.0f;
+			}
+		}
 	}
 }
\ No newline at end of file
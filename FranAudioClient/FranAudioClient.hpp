@@ -159,12 +159,120 @@ namespace FranAudioClient
 			/// Decode an audio file and load it into the memory.
 			/// </summary>
 			/// <param name="filename">Path to the audio file</param>
-			/// <returns>Wave Data Cache Index</returns>
-			FRANAUDIO_CLIENT_API size_t LoadAudioFile(const std::string& filename);
+			/// <returns>AssetID of the file</returns>
+			FRANAUDIO_CLIENT_API FranAudio::Backend::AssetID LoadAudioFile(const std::string& filename);
+
+			/// <summary>
+			/// Load every audio file listed in a manifest file, decoding them in parallel.
+			/// </summary>
+			/// <param name="manifestFilename">Path to the manifest file</param>
+			/// <returns>AssetIDs, in the same order as the manifest entries</returns>
+			FRANAUDIO_CLIENT_API const std::vector<FranAudio::Backend::AssetID> LoadAudioManifest(const std::string& manifestFilename);
+
+			/// <summary>
+			/// Map a baked sound bank and register every entry in it, without decoding anything.
+			/// </summary>
+			/// <param name="bankFilename">Path to the sound bank</param>
+			/// <returns>Number of entries registered, SIZE_MAX if the bank can't be opened</returns>
+			FRANAUDIO_CLIENT_API size_t LoadSoundBank(const std::string& bankFilename);
+
+			/// <summary>
+			/// Remove a loaded audio file from the memory.
+			/// Files that are still being played can't be unloaded.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <returns>True if the file was unloaded</returns>
+			FRANAUDIO_CLIENT_API bool UnloadAudioFile(const std::string& filename);
+
+			/// <summary>
+			/// Set the maximum size of the decoded audio data that's kept in the memory.
+			/// </summary>
+			/// <param name="budgetBytes">Budget in bytes, 0 means unlimited</param>
+			FRANAUDIO_CLIENT_API void SetMemoryBudget(size_t budgetBytes);
+
+			/// <summary>
+			/// Set how an audio file will be kept in the memory when it's loaded.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <param name="residency">Keep it decoded, compressed, streamed or decide by the size</param>
+			/// <param name="compressedThreshold">File size to keep it compressed at, for Auto</param>
+			/// <param name="resampleToEngine">Convert to the engine's sample rate and channels at load time</param>
+			/// <param name="streamThreshold">Decoded size to stream it from the disk at, for Auto</param>
+			FRANAUDIO_CLIENT_API void SetAssetLoadOptions(const std::string& filename, FranAudio::Backend::ResidencyMode residency, uint64_t compressedThreshold = 0, bool resampleToEngine = false, uint64_t streamThreshold = 0);
+
+			/// <summary>
+			/// Enable the persistent on-disk cache of decoded audio files.
+			/// </summary>
+			/// <param name="directory">Path to the cache directory</param>
+			/// <param name="maxBytes">Size limit of the directory, 0 means unlimited</param>
+			/// <returns>True if the cache is enabled</returns>
+			FRANAUDIO_CLIENT_API bool SetDiskCache(const std::string& directory, uint64_t maxBytes = 0);
+
+			/// <summary>
+			/// Get the size of the decoded audio data that's currently in the memory.
+			/// </summary>
+			/// <returns>Resident size in bytes</returns>
+			FRANAUDIO_CLIENT_API size_t GetResidentBytes();
+
+			/// <summary>
+			/// Get the size of the audio data that's shared between identical files instead of being stored again.
+			/// </summary>
+			/// <returns>Saved size in bytes</returns>
+			FRANAUDIO_CLIENT_API size_t GetDeduplicatedBytes();
+
+			/// <summary>
+			/// Get the AssetID of a loaded audio file.
+			/// Cache it and play with PlayAudioAsset, so the path isn't sent on every play.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <returns>AssetID of the file, InvalidAssetID if it's not loaded</returns>
+			FRANAUDIO_CLIENT_API FranAudio::Backend::AssetID GetAssetID(const std::string& filename);
+
+			/// <summary>
+			/// Play a loaded audio file by its AssetID.
+			/// </summary>
+			/// <param name="assetID">AssetID returned by LoadAudioFile or GetAssetID</param>
+			/// <returns>Active Sounds List Index</returns>
+			FRANAUDIO_CLIENT_API size_t PlayAudioAsset(FranAudio::Backend::AssetID assetID);
+
+			/// <summary>
+			/// Set the maximum time a sound played with PlayAudioFile can wait for its audio file to be loaded.
+			/// </summary>
+			/// <param name="latencyMilliseconds">Maximum latency, 0 means unlimited</param>
+			FRANAUDIO_CLIENT_API void SetMaxPlayLatency(size_t latencyMilliseconds);
+
+			/// <summary>
+			/// Set the maximum number of sounds that are mixed at once, the least audible ones are virtualised.
+			/// </summary>
+			/// <param name="maxVoices">Maximum number of mixed sounds, 0 means unlimited</param>
+			FRANAUDIO_CLIENT_API void SetMaxRealVoices(size_t maxVoices);
+
+			/// <summary>
+			/// Set the maximum number of sounds an audio file can play at once.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <param name="maxInstances">Maximum number of sounds, 0 means unlimited</param>
+			/// <param name="policy">Which sound to stop for a new one, or reject the new one</param>
+			FRANAUDIO_CLIENT_API void SetInstanceLimit(const std::string& filename, size_t maxInstances, FranAudio::Backend::VoiceStealPolicy policy = FranAudio::Backend::VoiceStealPolicy::Oldest);
+
+			/// <summary>
+			/// Put an audio file in an instance group, so its sounds count towards the group's limit too.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <param name="group">Name of the group, empty to remove it from its group</param>
+			FRANAUDIO_CLIENT_API void SetInstanceGroup(const std::string& filename, const std::string& group);
+
+			/// <summary>
+			/// Set the maximum number of sounds the audio files of a group can play at once, in total.
+			/// </summary>
+			/// <param name="group">Name of the group</param>
+			/// <param name="maxInstances">Maximum number of sounds, 0 means unlimited</param>
+			/// <param name="policy">Which sound to stop for a new one, or reject the new one</param>
+			FRANAUDIO_CLIENT_API void SetGroupInstanceLimit(const std::string& group, size_t maxInstances, FranAudio::Backend::VoiceStealPolicy policy = FranAudio::Backend::VoiceStealPolicy::Oldest);
 
 			/// <summary>
 			/// Play an audio file after checking if it's loaded.
-			/// If the audio file is not loaded, it will be loaded and then played.
+			/// If the audio file is not loaded, it's loaded in the background and played once it's ready.
 			/// </summary>
 			/// <param name="filename">Path to the audio file</param>
 			/// <returns>Active Sounds List Index</returns>
@@ -186,6 +294,61 @@ namespace FranAudioClient
 			/// <returns>Active Sounds List Index</returns>
 			FRANAUDIO_CLIENT_API size_t PlayAudioFileStream(const std::string& filename);
 
+			/// <summary>
+			/// Keep the start of an audio file decoded in memory, so PlayAudioFileStream can start it without touching the disk.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <param name="lengthMilliseconds">Length of the start to keep</param>
+			/// <returns>True if the head is loaded</returns>
+			FRANAUDIO_CLIENT_API bool LoadStreamHead(const std::string& filename, size_t lengthMilliseconds);
+
+			/// <summary>
+			/// Remove the decoded start of an audio file from memory.
+			/// </summary>
+			/// <param name="filename">Path to the audio file</param>
+			/// <returns>True if the file had a head loaded</returns>
+			FRANAUDIO_CLIENT_API bool UnloadStreamHead(const std::string& filename);
+
+			/// <summary>
+			/// Set the read-ahead and the worker threads of streamed sounds.
+			/// </summary>
+			/// <param name="workerThreads">Number of threads that decode the streams</param>
+			/// <param name="readAheadMilliseconds">Length of the audio decoded ahead of the mixer, per stream</param>
+			/// <param name="minReadMilliseconds">Free buffer space that's worth a read from the disk</param>
+			FRANAUDIO_CLIENT_API void SetStreamingSettings(uint32_t workerThreads, size_t readAheadMilliseconds, size_t minReadMilliseconds);
+
+			/// <summary>
+			/// Get the buffer and underrun statistics of a streamed sound.
+			/// </summary>
+			/// <param name="soundID">ID returned by PlayAudioFileStream</param>
+			/// <returns>Statistics of the stream, all zero if the sound is not streamed</returns>
+			FRANAUDIO_CLIENT_API FranAudio::Backend::StreamStats GetStreamStats(size_t soundID);
+
+			/// <summary>
+			/// Stream a list of audio files back to back as a single sound.
+			/// </summary>
+			/// <param name="filenames">Paths to the audio files, in playing order</param>
+			/// <param name="crossfadeMilliseconds">Length of the crossfade between the tracks, 0 for gapless playback</param>
+			/// <returns>Active Sounds List Index</returns>
+			FRANAUDIO_CLIENT_API size_t PlayPlaylist(const std::vector<std::string>& filenames, size_t crossfadeMilliseconds = 0);
+
+			/// <summary>
+			/// Add a track to the end of a playlist.
+			/// </summary>
+			/// <param name="soundID">ID returned by PlayPlaylist</param>
+			/// <param name="filename">Path to the audio file</param>
+			/// <param name="crossfadeMilliseconds">Length of the crossfade from the previous track, 0 for a gapless switch</param>
+			/// <returns>True if the track is queued</returns>
+			FRANAUDIO_CLIENT_API bool QueuePlaylistTrack(size_t soundID, const std::string& filename, size_t crossfadeMilliseconds = 0);
+
+			/// <summary>
+			/// Move a playlist on to its next track now.
+			/// </summary>
+			/// <param name="soundID">ID returned by PlayPlaylist</param>
+			/// <param name="crossfadeMilliseconds">Length of the crossfade from the current position, 0 to switch right away</param>
+			/// <returns>True if the skip is requested</returns>
+			FRANAUDIO_CLIENT_API bool SkipPlaylistTrack(size_t soundID, size_t crossfadeMilliseconds = 0);
+
 			// ========================
 			// Macro Sound Management
 			// ========================
@@ -242,6 +405,28 @@ namespace FranAudioClient
 			/// <param name="soundID">ID of the sound to get the position of</param>
 			/// <param name="position">Output position of the sound</param>
 			FRANAUDIO_CLIENT_API void GetPosition(size_t soundID, float position[3]);
+
+			/// <summary>
+			/// Move the playback position of a sound.
+			/// </summary>
+			/// <param name="soundID">ID of the sound to seek</param>
+			/// <param name="seconds">New position from the start of the sound, in seconds</param>
+			/// <returns>True if the seek is requested</returns>
+			FRANAUDIO_CLIENT_API bool Seek(size_t soundID, double seconds);
+
+			/// <summary>
+			/// Set the priority of a sound, used for choosing the sounds that are mixed.
+			/// </summary>
+			/// <param name="soundID">ID of the sound to set the priority of</param>
+			/// <param name="priority">Priority of the sound, 1.0 by default</param>
+			FRANAUDIO_CLIENT_API void SetPriority(size_t soundID, float priority);
+
+			/// <summary>
+			/// Get the priority of a sound.
+			/// </summary>
+			/// <param name="soundID">ID of the sound to get the priority of</param>
+			/// <returns>Priority of the sound</returns>
+			FRANAUDIO_CLIENT_API float GetPriority(size_t soundID);
 		}
 	}
 }
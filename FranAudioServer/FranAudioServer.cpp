@@ -21,6 +21,11 @@ void FranAudioServer::Init()
 	FranAudioShared::Logger::LogMessage("FranAudioServer::Init() Done");
 }
 
+void FranAudioServer::Update()
+{
+	FranAudio::Update();
+}
+
 std::string FranAudioServer::Receive(const char* buffer)
 {
 	if (buffer == nullptr)
@@ -318,7 +323,7 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 
 	// Backend::LoadAudioFile
 	// Params: filename
-	// Returns: wave data index
+	// Returns: AssetID
 	{
 		"backend-load_audio_file",
 		[](const FranAudioShared::Network::NetworkFunction& fn)
@@ -334,6 +339,308 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 	},
 
 
+	// Backend::LoadAudioManifest
+	// Params: manifestFilename
+	// Returns: AssetIDs as a binary serialised vector
+	{
+		"backend-load_audio_manifest",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter for load_audio_manifest");
+				return std::string("err");
+			}
+
+			const auto assetIDs = FranAudio::GetBackend()->LoadAudioManifest(fn.params[0]);
+			return assetIDs.empty() ? std::string() : FranAudioShared::Serialisation::BinarySerialiser::SerialiseVector(assetIDs);
+		}
+	},
+
+	// Backend::LoadSoundBank
+	// Params: bankFilename
+	// Returns: number of entries registered
+	{
+		"backend-load_sound_bank",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter for load_sound_bank");
+				return std::string("err");
+			}
+
+			return std::to_string(FranAudio::GetBackend()->LoadSoundBank(fn.params[0]));
+		}
+	},
+
+	// Backend::UnloadAudioFile
+	// Params: filename
+	// Returns: "1" if unloaded, "0" if not
+	{
+		"backend-unload_audio_file",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter for unload_audio_file");
+				return std::string("err");
+			}
+
+			return FranAudio::GetBackend()->UnloadAudioFile(fn.params[0]) ? std::string("1") : std::string("0");
+		}
+	},
+
+	// Backend::SetMemoryBudget
+	// Params: budgetBytes
+	// Returns: nothing
+	{
+		"backend-set_memory_budget",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing budget parameter for set_memory_budget");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::GetBackend()->SetMemoryBudget(std::stoull(fn.params[0]));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set memory budget: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::SetAssetLoadOptions
+	// Params: filename, residency mode, compressed threshold, resample to engine (optional), stream threshold (optional)
+	// Returns: nothing
+	{
+		"backend-set_asset_load_options",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 3)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_asset_load_options");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::Backend::AssetLoadOptions options;
+				options.residency = static_cast<FranAudio::Backend::ResidencyMode>(std::stoi(fn.params[1]));
+				options.compressedThreshold = std::stoull(fn.params[2]);
+				if (fn.params.size() > 3)
+				{
+					options.resampleToEngine = fn.params[3] == "1";
+				}
+				if (fn.params.size() > 4)
+				{
+					options.streamThreshold = std::stoull(fn.params[4]);
+				}
+				FranAudio::GetBackend()->SetAssetLoadOptions(fn.params[0], options);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set asset load options: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::SetDiskCache
+	// Params: directory, max bytes
+	// Returns: "1" if enabled, "0" if not
+	{
+		"backend-set_disk_cache",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_disk_cache");
+				return std::string("err");
+			}
+
+			try
+			{
+				return FranAudio::GetBackend()->SetDiskCache(fn.params[0], std::stoull(fn.params[1])) ? std::string("1") : std::string("0");
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set disk cache: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
+	// Backend::GetResidentBytes
+	// Params: none
+	// Returns: resident bytes
+	{
+		"backend-get_resident_bytes",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			return std::to_string(FranAudio::GetBackend()->GetResidentBytes());
+		}
+	},
+
+	// Backend::GetDeduplicatedBytes
+	// Params: none
+	// Returns: deduplicated bytes
+	{
+		"backend-get_deduplicated_bytes",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			return std::to_string(FranAudio::GetBackend()->GetDeduplicatedBytes());
+		}
+	},
+
+	// Backend::SetMaxRealVoices
+	// Params: max real voices, 0 for unlimited
+	// Returns: nothing
+	{
+		"backend-set_max_real_voices",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing voice count parameter for set_max_real_voices");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::GetBackend()->SetMaxRealVoices(std::stoull(fn.params[0]));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set max real voices: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::SetInstanceLimit
+	// Params: filename, max instances (0 removes the limit), steal policy (optional)
+	// Returns: nothing
+	{
+		"backend-set_instance_limit",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_instance_limit");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::Backend::InstanceLimit limit;
+				limit.maxInstances = std::stoull(fn.params[1]);
+				if (fn.params.size() > 2)
+				{
+					limit.policy = static_cast<FranAudio::Backend::VoiceStealPolicy>(std::stoi(fn.params[2]));
+				}
+				FranAudio::GetBackend()->SetInstanceLimit(fn.params[0], limit);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set instance limit: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::SetInstanceGroup
+	// Params: filename, group (optional, none removes it from its group)
+	// Returns: nothing
+	{
+		"backend-set_instance_group",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter for set_instance_group");
+				return std::string("err");
+			}
+
+			FranAudio::GetBackend()->SetInstanceGroup(fn.params[0], fn.params.size() > 1 ? fn.params[1] : std::string());
+			return std::string();
+		}
+	},
+
+	// Backend::SetGroupInstanceLimit
+	// Params: group, max instances (0 removes the limit), steal policy (optional)
+	// Returns: nothing
+	{
+		"backend-set_group_instance_limit",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_group_instance_limit");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::Backend::InstanceLimit limit;
+				limit.maxInstances = std::stoull(fn.params[1]);
+				if (fn.params.size() > 2)
+				{
+					limit.policy = static_cast<FranAudio::Backend::VoiceStealPolicy>(std::stoi(fn.params[2]));
+				}
+				FranAudio::GetBackend()->SetGroupInstanceLimit(fn.params[0], limit);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set group instance limit: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::SetMaxPlayLatency
+	// Params: latency in milliseconds
+	// Returns: nothing
+	{
+		"backend-set_max_play_latency",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing latency parameter for set_max_play_latency");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::GetBackend()->SetMaxPlayLatency(std::chrono::milliseconds(std::stoull(fn.params[0])));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set max play latency: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
 	// Backend::PlayAudioFile
 	// Params: filename
 	// Returns: sound index
@@ -351,6 +658,48 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 		}
 	},
 
+	// Backend::GetAssetID
+	// Params: filename
+	// Returns: asset ID
+	{
+		"backend-get_asset_id",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter");
+				return std::string("err");
+			}
+
+			return std::to_string(FranAudio::GetBackend()->GetAssetID(fn.params[0]));
+		}
+	},
+
+	// Backend::PlayAudioAsset
+	// Params: asset ID
+	// Returns: sound index
+	{
+		"backend-play_audio_asset",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing asset ID parameter");
+				return std::string("err");
+			}
+
+			try
+			{
+				return std::to_string(FranAudio::GetBackend()->PlayAudioAsset(std::stoull(fn.params[0])));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Invalid asset ID parameter: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
 	// Backend::PlayAudioFileNoChecks
 	// Params: filename
 	// Returns: sound index
@@ -383,6 +732,184 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 		}
 	},
 
+	// Backend::LoadStreamHead
+	// Params: filename, head length in milliseconds
+	// Returns: 1 if the head is loaded, 0 otherwise
+	{
+		"backend-load_stream_head",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for load_stream_head");
+				return std::string("err");
+			}
+
+			try
+			{
+				return std::string(FranAudio::GetBackend()->LoadStreamHead(fn.params[0], std::chrono::milliseconds(std::stoull(fn.params[1]))) ? "1" : "0");
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to load stream head: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
+	// Backend::UnloadStreamHead
+	// Params: filename
+	// Returns: 1 if the head was unloaded, 0 otherwise
+	{
+		"backend-unload_stream_head",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing filename parameter for unload_stream_head");
+				return std::string("err");
+			}
+
+			return std::string(FranAudio::GetBackend()->UnloadStreamHead(fn.params[0]) ? "1" : "0");
+		}
+	},
+
+	// Backend::SetStreamingSettings
+	// Params: worker threads, read-ahead in milliseconds, minimum read length in milliseconds
+	// Returns: nothing
+	{
+		"backend-set_streaming_settings",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 3)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_streaming_settings");
+				return std::string("err");
+			}
+
+			try
+			{
+				FranAudio::Backend::StreamingSettings settings;
+				settings.workerThreads = static_cast<uint32_t>(std::stoul(fn.params[0]));
+				settings.readAhead = std::chrono::milliseconds(std::stoull(fn.params[1]));
+				settings.minReadLength = std::chrono::milliseconds(std::stoull(fn.params[2]));
+				FranAudio::GetBackend()->SetStreamingSettings(settings);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set streaming settings: {}", e.what()));
+				return std::string("err");
+			}
+
+			return std::string();
+		}
+	},
+
+	// Backend::GetStreamStats
+	// Params: sound index
+	// Returns: underruns, underrun frames, buffered frames, capacity frames and reads as a binary serialised vector
+	{
+		"backend-get_stream_stats",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing sound index parameter for get_stream_stats");
+				return std::string("err");
+			}
+
+			FranAudio::Backend::StreamStats stats;
+			try
+			{
+				stats = FranAudio::GetBackend()->GetStreamStats(std::stoull(fn.params[0]));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to get stream stats: {}", e.what()));
+				return std::string("err");
+			}
+
+			const std::vector<uint64_t> values = { stats.underruns, stats.underrunFrames, stats.bufferedFrames, stats.capacityFrames, stats.reads };
+			return FranAudioShared::Serialisation::BinarySerialiser::SerialiseVector(values);
+		}
+	},
+
+	// Backend::PlayPlaylist
+	// Params: crossfade in milliseconds, filenames...
+	// Returns: sound index
+	{
+		"backend-play_playlist",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for play_playlist");
+				return std::string("err");
+			}
+
+			try
+			{
+				const std::vector<std::string> filenames(fn.params.begin() + 1, fn.params.end());
+				return std::to_string(FranAudio::GetBackend()->PlayPlaylist(filenames, std::chrono::milliseconds(std::stoull(fn.params[0]))));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to play playlist: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
+	// Backend::QueuePlaylistTrack
+	// Params: sound index, filename, crossfade in milliseconds
+	// Returns: 1 if the track is queued, 0 otherwise
+	{
+		"backend-queue_playlist_track",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 3)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for queue_playlist_track");
+				return std::string("err");
+			}
+
+			try
+			{
+				return std::string(FranAudio::GetBackend()->QueuePlaylistTrack(std::stoull(fn.params[0]), fn.params[1], std::chrono::milliseconds(std::stoull(fn.params[2]))) ? "1" : "0");
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to queue playlist track: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
+	// Backend::SkipPlaylistTrack
+	// Params: sound index, crossfade in milliseconds
+	// Returns: 1 if the skip is requested, 0 otherwise
+	{
+		"backend-skip_playlist_track",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for skip_playlist_track");
+				return std::string("err");
+			}
+
+			try
+			{
+				return std::string(FranAudio::GetBackend()->SkipPlaylistTrack(std::stoull(fn.params[0]), std::chrono::milliseconds(std::stoull(fn.params[1]))) ? "1" : "0");
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to skip playlist track: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
 	// Sound::GetActiveSoundIDs
 	// Params: none
 	// Returns: Active sound ids as a binary serialised vector
@@ -390,7 +917,7 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 		"backend-get_active_sound_ids",
 		[](const FranAudioShared::Network::NetworkFunction& fn)
 		{
-			return FranAudio::GetBackend()->GetActiveSounds().size() < 1 ? std::string() : FranAudioShared::Serialisation::BinarySerialiser::SerialiseVector(FranAudio::GetBackend()->GetActiveSoundIDs());
+			return FranAudio::GetBackend()->GetActiveSounds().Size() < 1 ? std::string() : FranAudioShared::Serialisation::BinarySerialiser::SerialiseVector(FranAudio::GetBackend()->GetActiveSoundIDs());
 		}
 	},
 
@@ -582,4 +1109,82 @@ const FranAudioShared::Containers::UnorderedMap<std::string, std::function<std::
 			}
 		}
 	},
+
+	// Sound::Seek
+	// Params: soundIndex, seconds
+	// Returns: 1 if the seek is requested, 0 otherwise
+	{
+		"sound-seek",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for sound seek");
+				return std::string("err");
+			}
+			try
+			{
+				const size_t soundId = std::stoull(fn.params[0]);
+				const double seconds = std::stod(fn.params[1]);
+				return std::string(FranAudio::GetBackend()->SeekSound(soundId, seconds) ? "1" : "0");
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to seek sound: {}", e.what()));
+				return std::string("err");
+			}
+		}
+	},
+
+	// Sound::SetPriority
+	// Params: soundIndex, priority
+	// Returns: nothing
+	{
+		"sound-set_priority",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 2)
+			{
+				FranAudioShared::Logger::LogError("Missing parameters for set_sound_priority");
+				return std::string("err");
+			}
+			try
+			{
+				const size_t soundId = std::stoull(fn.params[0]);
+				const float priority = std::stof(fn.params[1]);
+				FranAudio::GetBackend()->SetSoundPriority(soundId, priority);
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to set sound priority: {}", e.what()));
+				return std::string("err");
+			}
+			return std::string();
+		}
+	},
+
+	// Sound::GetPriority
+	// Params: soundIndex
+	// Returns: priority, or "err" on error
+	{
+		"sound-get_priority",
+		[](const FranAudioShared::Network::NetworkFunction& fn)
+		{
+			if (fn.params.size() < 1)
+			{
+				FranAudioShared::Logger::LogError("Missing sound ID parameter");
+				return std::string("err");
+			}
+			try
+			{
+				const size_t soundId = std::stoull(fn.params[0]);
+				return std::to_string(FranAudio::GetBackend()->GetSoundPriority(soundId));
+			}
+			catch (const std::exception& e)
+			{
+				FranAudioShared::Logger::LogError(std::format("Failed to get priority of sound with ID {}: {}", fn.params[0], e.what()));
+				return std::string("err");
+			}
+		}
+	},
 };
\ No newline at end of file
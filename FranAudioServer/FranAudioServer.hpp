@@ -4,14 +4,26 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <chrono>
 
 #include "FranAudioShared/Network/Network.hpp"
 
 namespace FranAudioServer
 {
+	/// <summary>
+	/// How often the backend is updated while the client is quiet.
+	/// Asynchronous loads, finished sounds and playlists only progress in the updates.
+	/// </summary>
+	constexpr std::chrono::milliseconds updateInterval{ 10 };
+
 	void Init();
 	void Shutdown();
 
+	/// <summary>
+	/// Update the backend. Called by the server loop on every request, and every updateInterval between them.
+	/// </summary>
+	void Update();
+
 	std::string Receive(const char* buffer);
 
 	/// <summary>
@@ -89,6 +89,29 @@ int main()
 	bool shutDown = false;
 	while (!shutDown)
 	{
+		// Wait for the next request, but keep the backend updated while the client is quiet
+		fd_set readSet;
+		FD_ZERO(&readSet);
+		FD_SET(clientSocket, &readSet);
+
+		timeval timeout = {};
+		timeout.tv_usec = static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(FranAudioServer::updateInterval).count());
+
+		const int ready = select(0, &readSet, nullptr, nullptr, &timeout);
+
+		FranAudioServer::Update();
+
+		if (ready == SOCKET_ERROR)
+		{
+			FranAudioShared::Logger::LogError("Select failed!");
+			break;
+		}
+
+		if (ready == 0)
+		{
+			continue;
+		}
+
 		std::string request = FranAudioShared::Network::Win32Helpers::RecvFrame(clientSocket);
 
 		std::string response = FranAudioServer::Receive(request.c_str());
@@ -0,0 +1,172 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
+
+namespace FranAudioShared::Containers
+{
+	/// <summary>
+	/// A fixed-size, lock-free ring buffer for one producer thread and one consumer thread.
+	///
+	/// Write() must only be called from the producer thread and Read() from the consumer thread,
+	/// other functions can be called from either. Neither side ever blocks or allocates,
+	/// so the consumer can be a real-time thread like the audio callback.
+	/// </summary>
+	/// <typeparam name="T">Element type, must be trivially copyable</typeparam>
+	template <typename T>
+	class RingBuffer
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "RingBuffer elements must be trivially copyable");
+
+	private:
+		std::vector<T> buffer;
+		size_t mask = 0;
+
+		/// <summary>
+		/// Total number of elements written and read.
+		/// They only grow, so their difference is the number of readable elements.
+		/// </summary>
+		alignas(64) std::atomic<size_t> writeCount = 0;
+		alignas(64) std::atomic<size_t> readCount = 0;
+
+	public:
+		RingBuffer() = default;
+		RingBuffer(const RingBuffer&) = delete;
+		RingBuffer& operator=(const RingBuffer&) = delete;
+
+		/// <summary>
+		/// Allocate the buffer, discarding its contents.
+		/// Must not be called while the producer or the consumer is using it.
+		/// </summary>
+		/// <param name="minCapacity">Minimum number of elements, rounded up to a power of two</param>
+		void Allocate(size_t minCapacity)
+		{
+			size_t capacity = 1;
+			while (capacity < minCapacity)
+			{
+				capacity <<= 1;
+			}
+
+			buffer.assign(capacity, T());
+			mask = capacity - 1;
+			writeCount.store(0, std::memory_order_relaxed);
+			readCount.store(0, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Discard the contents without freeing the buffer.
+		/// Must not be called while the producer or the consumer is using it.
+		/// </summary>
+		void Clear()
+		{
+			writeCount.store(0, std::memory_order_relaxed);
+			readCount.store(0, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Copy elements into the buffer. Producer thread only.
+		/// </summary>
+		/// <param name="data">Elements to copy</param>
+		/// <param name="count">Number of elements</param>
+		/// <returns>Number of elements written, less than count if the buffer is full</returns>
+		size_t Write(const T* data, size_t count)
+		{
+			const size_t write = writeCount.load(std::memory_order_relaxed);
+			const size_t read = readCount.load(std::memory_order_acquire);
+
+			count = std::min(count, buffer.size() - (write - read));
+
+			const size_t start = write & mask;
+			const size_t firstPart = std::min(count, buffer.size() - start);
+			std::copy_n(data, firstPart, buffer.data() + start);
+			std::copy_n(data + firstPart, count - firstPart, buffer.data());
+
+			writeCount.store(write + count, std::memory_order_release);
+			return count;
+		}
+
+		/// <summary>
+		/// Copy elements out of the buffer. Consumer thread only.
+		/// </summary>
+		/// <param name="outData">Output elements</param>
+		/// <param name="count">Number of elements</param>
+		/// <returns>Number of elements read, less than count if the buffer is empty</returns>
+		size_t Read(T* outData, size_t count)
+		{
+			const size_t read = readCount.load(std::memory_order_relaxed);
+			const size_t write = writeCount.load(std::memory_order_acquire);
+
+			count = std::min(count, write - read);
+
+			const size_t start = read & mask;
+			const size_t firstPart = std::min(count, buffer.size() - start);
+			std::copy_n(buffer.data() + start, firstPart, outData);
+			std::copy_n(buffer.data(), count - firstPart, outData + firstPart);
+
+			readCount.store(read + count, std::memory_order_release);
+			return count;
+		}
+
+		/// <summary>
+		/// Drop elements without copying them out. Consumer thread only.
+		/// </summary>
+		/// <param name="count">Number of elements</param>
+		/// <returns>Number of elements dropped, less than count if the buffer is empty</returns>
+		size_t Skip(size_t count)
+		{
+			const size_t read = readCount.load(std::memory_order_relaxed);
+			const size_t write = writeCount.load(std::memory_order_acquire);
+
+			count = std::min(count, write - read);
+
+			readCount.store(read + count, std::memory_order_release);
+			return count;
+		}
+
+		/// <summary>
+		/// Get the total number of elements written since the buffer was allocated or cleared.
+		/// Can be used to mark a position in the stream of elements.
+		/// </summary>
+		[[nodiscard]] size_t GetTotalWritten() const
+		{
+			return writeCount.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Get the total number of elements read since the buffer was allocated or cleared.
+		/// </summary>
+		[[nodiscard]] size_t GetTotalRead() const
+		{
+			return readCount.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Get the number of elements that can be read.
+		/// </summary>
+		[[nodiscard]] size_t GetReadable() const
+		{
+			// Read count first, so the write count can't be older than it
+			const size_t read = readCount.load(std::memory_order_acquire);
+			return writeCount.load(std::memory_order_acquire) - read;
+		}
+
+		/// <summary>
+		/// Get the number of elements that can be written.
+		/// </summary>
+		[[nodiscard]] size_t GetWritable() const
+		{
+			return buffer.size() - GetReadable();
+		}
+
+		/// <summary>
+		/// Get the maximum number of elements the buffer can hold.
+		/// </summary>
+		[[nodiscard]] size_t GetCapacity() const
+		{
+			return buffer.size();
+		}
+	};
+}
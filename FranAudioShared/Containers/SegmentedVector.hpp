@@ -0,0 +1,145 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <utility>
+
+namespace FranAudioShared::Containers
+{
+	/// <summary>
+	/// A vector-like container that never moves its elements.
+	///
+	/// Elements are stored in fixed-size segments, so growing the container only allocates a new segment
+	/// and references/pointers to existing elements stay valid until the container is cleared.
+	/// Index access is one division and two dereferences.
+	///
+	/// Uses STL-style naming, so it can replace a std::vector where only push/emplace and index access are used.
+	/// </summary>
+	/// <typeparam name="T">Element type</typeparam>
+	/// <typeparam name="SegmentSize">Number of elements per segment, should be a power of two</typeparam>
+	template <typename T, size_t SegmentSize = 64>
+	class SegmentedVector
+	{
+		static_assert(SegmentSize > 0, "SegmentSize must be greater than zero");
+
+	private:
+		using Allocator = std::allocator<T>;
+		using AllocatorTraits = std::allocator_traits<Allocator>;
+
+		Allocator allocator;
+		std::vector<T*> segments;
+		size_t count = 0;
+
+		T* ElementAddress(size_t index) const
+		{
+			return segments[index / SegmentSize] + (index % SegmentSize);
+		}
+
+	public:
+		SegmentedVector() = default;
+		SegmentedVector(const SegmentedVector&) = delete;
+		SegmentedVector& operator=(const SegmentedVector&) = delete;
+
+		SegmentedVector(SegmentedVector&& other) noexcept
+			: segments(std::move(other.segments)), count(std::exchange(other.count, 0))
+		{
+		}
+
+		SegmentedVector& operator=(SegmentedVector&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				segments = std::move(other.segments);
+				count = std::exchange(other.count, 0);
+			}
+			return *this;
+		}
+
+		~SegmentedVector()
+		{
+			clear();
+		}
+
+		/// <summary>
+		/// Construct a new element at the end.
+		/// Never invalidates references to the existing elements.
+		/// </summary>
+		/// <returns>Reference to the new element</returns>
+		template <typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (count == segments.size() * SegmentSize)
+			{
+				segments.push_back(AllocatorTraits::allocate(allocator, SegmentSize));
+			}
+
+			T* address = ElementAddress(count);
+			AllocatorTraits::construct(allocator, address, std::forward<Args>(args)...);
+			count++;
+
+			return *address;
+		}
+
+		void push_back(const T& value)
+		{
+			emplace_back(value);
+		}
+
+		void push_back(T&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		T& operator[](size_t index)
+		{
+			return *ElementAddress(index);
+		}
+
+		const T& operator[](size_t index) const
+		{
+			return *ElementAddress(index);
+		}
+
+		T& back()
+		{
+			return *ElementAddress(count - 1);
+		}
+
+		const T& back() const
+		{
+			return *ElementAddress(count - 1);
+		}
+
+		[[nodiscard]] size_t size() const
+		{
+			return count;
+		}
+
+		[[nodiscard]] bool empty() const
+		{
+			return count == 0;
+		}
+
+		/// <summary>
+		/// Destroy every element and free every segment.
+		/// Invalidates every reference.
+		/// </summary>
+		void clear()
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				AllocatorTraits::destroy(allocator, ElementAddress(i));
+			}
+
+			for (T* segment : segments)
+			{
+				AllocatorTraits::deallocate(allocator, segment, SegmentSize);
+			}
+
+			segments.clear();
+			count = 0;
+		}
+	};
+}
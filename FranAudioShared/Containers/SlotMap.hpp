@@ -0,0 +1,250 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace FranAudioShared::Containers
+{
+	/// <summary>
+	/// Pack a slot index and the generation of the slot into a handle, see SlotMap.
+	/// </summary>
+	inline constexpr size_t MakeSlotHandle(size_t index, uint32_t generation)
+	{
+		return (static_cast<size_t>(generation) << 32) | index;
+	}
+
+	/// <summary>
+	/// Get the slot index of a handle, without checking it.
+	/// </summary>
+	inline constexpr size_t GetSlotIndex(size_t handle)
+	{
+		return handle & 0xFFFFFFFF;
+	}
+
+	/// <summary>
+	/// Get the slot generation of a handle.
+	/// </summary>
+	inline constexpr uint32_t GetSlotGeneration(size_t handle)
+	{
+		return static_cast<uint32_t>(handle >> 32);
+	}
+
+	/// <summary>
+	/// A map from generation-checked handles to densely indexed slots.
+	///
+	/// A handle packs a slot index in its low 32 bits and the generation of the slot in its high 32 bits.
+	/// Freeing a slot bumps its generation, so handles to a freed slot are stale even after the slot is reused.
+	/// Looking a handle up is one bounds check and one array index, no hashing involved.
+	///
+	/// Slots can be reserved before their value exists, so a handle can be handed out early.
+	/// Reserved slots are not contained until they're emplaced.
+	/// Slot indices never change, so data of a slot can be kept in parallel arrays, see IndexOf.
+	/// </summary>
+	/// <typeparam name="T">Value type, must be default constructible</typeparam>
+	template <typename T>
+	class SlotMap
+	{
+	private:
+		enum class SlotState : uint8_t
+		{
+			Free = 0,
+			Reserved,
+			Occupied,
+		};
+
+		struct Slot
+		{
+			T value = T();
+			uint32_t generation = 0;
+			SlotState state = SlotState::Free;
+		};
+
+		std::vector<Slot> slots;
+		std::vector<uint32_t> freeSlots;
+		size_t count = 0;
+
+		/// <summary>
+		/// Get the slot of a handle if it's not stale.
+		/// </summary>
+		Slot* FindSlot(size_t handle)
+		{
+			const size_t index = GetIndex(handle);
+			if (index >= slots.size() || slots[index].generation != GetSlotGeneration(handle))
+			{
+				return nullptr;
+			}
+
+			return &slots[index];
+		}
+
+		const Slot* FindSlot(size_t handle) const
+		{
+			return const_cast<SlotMap*>(this)->FindSlot(handle);
+		}
+
+	public:
+		/// <summary>
+		/// Get the slot index of a handle, without checking it.
+		/// </summary>
+		static size_t GetIndex(size_t handle)
+		{
+			return GetSlotIndex(handle);
+		}
+
+		/// <summary>
+		/// Allocate the slots up front, so adding that many values doesn't allocate.
+		/// </summary>
+		/// <param name="capacity">Number of slots</param>
+		void Reserve(size_t capacity)
+		{
+			slots.reserve(capacity);
+			freeSlots.reserve(capacity);
+		}
+
+		/// <summary>
+		/// Take a free slot without a value.
+		/// The handle is not contained until Emplace is called with it, and must be erased if it never is.
+		/// </summary>
+		/// <returns>Handle of the slot</returns>
+		size_t ReserveHandle()
+		{
+			size_t index;
+			if (!freeSlots.empty())
+			{
+				index = freeSlots.back();
+				freeSlots.pop_back();
+			}
+			else
+			{
+				index = slots.size();
+				slots.emplace_back();
+			}
+
+			slots[index].state = SlotState::Reserved;
+			return MakeSlotHandle(index, slots[index].generation);
+		}
+
+		/// <summary>
+		/// Construct the value of a reserved slot.
+		/// </summary>
+		/// <param name="handle">Handle returned by ReserveHandle</param>
+		/// <returns>Pointer to the value, nullptr if the handle is stale or not reserved</returns>
+		template <typename... Args>
+		T* Emplace(size_t handle, Args&&... args)
+		{
+			Slot* slot = FindSlot(handle);
+			if (slot == nullptr || slot->state != SlotState::Reserved)
+			{
+				return nullptr;
+			}
+
+			slot->value = T(std::forward<Args>(args)...);
+			slot->state = SlotState::Occupied;
+			count++;
+
+			return &slot->value;
+		}
+
+		/// <summary>
+		/// Free a reserved or occupied slot, making its handles stale.
+		/// </summary>
+		/// <returns>True if the handle wasn't stale</returns>
+		bool Erase(size_t handle)
+		{
+			Slot* slot = FindSlot(handle);
+			if (slot == nullptr || slot->state == SlotState::Free)
+			{
+				return false;
+			}
+
+			if (slot->state == SlotState::Occupied)
+			{
+				slot->value = T();
+				count--;
+			}
+
+			slot->state = SlotState::Free;
+			slot->generation++;
+			freeSlots.push_back(static_cast<uint32_t>(GetIndex(handle)));
+
+			return true;
+		}
+
+		/// <summary>
+		/// Check if a handle has a value.
+		/// </summary>
+		[[nodiscard]] bool Contains(size_t handle) const
+		{
+			const Slot* slot = FindSlot(handle);
+			return slot != nullptr && slot->state == SlotState::Occupied;
+		}
+
+		/// <summary>
+		/// Check if a handle is reserved and waiting for its value.
+		/// </summary>
+		[[nodiscard]] bool IsReserved(size_t handle) const
+		{
+			const Slot* slot = FindSlot(handle);
+			return slot != nullptr && slot->state == SlotState::Reserved;
+		}
+
+		/// <summary>
+		/// Get the slot index of a handle that has a value.
+		/// </summary>
+		/// <returns>Slot index, SIZE_MAX if the handle is stale or has no value</returns>
+		[[nodiscard]] size_t IndexOf(size_t handle) const
+		{
+			return Contains(handle) ? GetIndex(handle) : SIZE_MAX;
+		}
+
+		/// <summary>
+		/// Get the value of a handle.
+		/// </summary>
+		/// <returns>Pointer to the value, nullptr if the handle is stale or has no value</returns>
+		T* Find(size_t handle)
+		{
+			Slot* slot = FindSlot(handle);
+			return slot != nullptr && slot->state == SlotState::Occupied ? &slot->value : nullptr;
+		}
+
+		const T* Find(size_t handle) const
+		{
+			const Slot* slot = FindSlot(handle);
+			return slot != nullptr && slot->state == SlotState::Occupied ? &slot->value : nullptr;
+		}
+
+		/// <summary>
+		/// Call a function with the handle and the value of every slot that has a value.
+		/// </summary>
+		template <typename Function>
+		void ForEach(Function&& function) const
+		{
+			for (size_t i = 0; i < slots.size(); i++)
+			{
+				if (slots[i].state == SlotState::Occupied)
+				{
+					function(MakeSlotHandle(i, slots[i].generation), slots[i].value);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Get the number of values.
+		/// </summary>
+		[[nodiscard]] size_t Size() const
+		{
+			return count;
+		}
+
+		/// <summary>
+		/// Get the number of slots, free or not. Every slot index is less than this.
+		/// </summary>
+		[[nodiscard]] size_t GetSlotCount() const
+		{
+			return slots.size();
+		}
+	};
+}
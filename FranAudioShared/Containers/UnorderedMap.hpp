@@ -2122,6 +2122,26 @@ namespace FranAudioShared::Containers
 		class Bucket = ankerl::unordered_dense::bucket_type::standard,
 		class BucketContainer = ankerl::unordered_dense::detail::default_container_t>
 	using UnorderedMap = ankerl::unordered_dense::detail::table<Key, T, Hash, KeyEqual, AllocatorOrContainer, Bucket, BucketContainer, false>;
+
+	/// <summary>
+	/// Transparent string hash, so string maps can be searched with string views and C strings without allocating.
+	/// </summary>
+	struct StringHash
+	{
+		using is_transparent = void;
+		using is_avalanching = void;
+
+		[[nodiscard]] uint64_t operator()(std::string_view str) const noexcept
+		{
+			return ankerl::unordered_dense::detail::wyhash::hash(str.data(), str.size());
+		}
+	};
+
+	/// <summary>
+	/// UnorderedMap with string keys that can be searched with std::string_view.
+	/// </summary>
+	template <class T>
+	using StringMap = UnorderedMap<std::string, T, StringHash, std::equal_to<>>;
 }
 
 // ====================
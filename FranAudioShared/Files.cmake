@@ -15,6 +15,15 @@ FILE(GLOB FRANAUDIOSHARED_HEADERFILES
 
 	#Containers
 	FranAudioShared/Containers/UnorderedMap.hpp
+	FranAudioShared/Containers/SegmentedVector.hpp
+	FranAudioShared/Containers/RingBuffer.hpp
+	FranAudioShared/Containers/SlotMap.hpp
+
+	#Threading
+	FranAudioShared/Threading/ThreadPool.hpp
+
+	#IO
+	FranAudioShared/IO/MappedFile.hpp
 	)
 
 # Source files
@@ -22,6 +31,14 @@ FILE(GLOB FRANAUDIOSHARED_SOURCEFILES
 
 	#Logger
 	FranAudioShared/Logger/Logger.cpp
+
+	#Threading
+	FranAudioShared/Threading/ThreadPool.cpp
+
+	#IO
+	FranAudioShared/IO/MappedFile.cpp
+	FranAudioShared/IO/MappedFile_Win32.cpp
+	FranAudioShared/IO/MappedFile_Linux.cpp
 	)
 
 #include_directories("FranAudioShared")
@@ -0,0 +1,52 @@
+// FranticDreamer 2022-2025
+
+#include <utility>
+
+#include "MappedFile.hpp"
+
+// Platform specific parts are in MappedFile_Win32.cpp and MappedFile_Linux.cpp
+
+FranAudioShared::IO::MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+FranAudioShared::IO::MappedFile& FranAudioShared::IO::MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+		data = std::exchange(other.data, nullptr);
+		size = std::exchange(other.size, 0);
+#ifdef _WIN32
+		fileHandle = std::exchange(other.fileHandle, nullptr);
+		mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+	}
+	return *this;
+}
+
+FranAudioShared::IO::MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool FranAudioShared::IO::MappedFile::IsOpen() const
+{
+	return data != nullptr;
+}
+
+const uint8_t* FranAudioShared::IO::MappedFile::GetData() const
+{
+	return data;
+}
+
+size_t FranAudioShared::IO::MappedFile::GetSize() const
+{
+	return size;
+}
+
+std::span<const uint8_t> FranAudioShared::IO::MappedFile::GetSpan() const
+{
+	return { data, size };
+}
@@ -0,0 +1,69 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <string>
+#include <span>
+#include <cstdint>
+
+namespace FranAudioShared::IO
+{
+	/// <summary>
+	/// A read-only memory-mapped file.
+	///
+	/// The whole file is mapped once and read straight from the OS page cache,
+	/// without going through buffered file I/O or copying it into our own buffer.
+	/// The mapping stays valid until the file is closed or the object is destroyed.
+	/// </summary>
+	class MappedFile
+	{
+	private:
+		const uint8_t* data = nullptr;
+		size_t size = 0;
+
+#ifdef _WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#endif
+
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+		~MappedFile();
+
+		/// <summary>
+		/// Map a file into the memory.
+		/// Closes the previously mapped file, if any.
+		/// </summary>
+		/// <param name="filename">Path to the file</param>
+		/// <returns>True if the file was mapped. Empty files can't be mapped.</returns>
+		bool Open(const std::string& filename);
+
+		/// <summary>
+		/// Unmap the file.
+		/// Invalidates every pointer to the file data.
+		/// </summary>
+		void Close();
+
+		[[nodiscard]] bool IsOpen() const;
+
+		/// <summary>
+		/// Get the mapped file data.
+		/// </summary>
+		/// <returns>Pointer to the start of the file, nullptr if no file is mapped</returns>
+		[[nodiscard]] const uint8_t* GetData() const;
+
+		/// <summary>
+		/// Get the size of the mapped file.
+		/// </summary>
+		/// <returns>File size in bytes, 0 if no file is mapped</returns>
+		[[nodiscard]] size_t GetSize() const;
+
+		/// <summary>
+		/// Get the mapped file data as a span.
+		/// </summary>
+		[[nodiscard]] std::span<const uint8_t> GetSpan() const;
+	};
+}
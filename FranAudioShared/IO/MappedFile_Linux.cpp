@@ -0,0 +1,59 @@
+// FranticDreamer 2022-2025
+
+#ifdef __linux__
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "MappedFile.hpp"
+
+bool FranAudioShared::IO::MappedFile::Open(const std::string& filename)
+{
+	Close();
+
+	const int fileDescriptor = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fileDescriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat = {};
+	if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+	{
+		close(fileDescriptor);
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+	// Mapping keeps its own reference to the file
+	close(fileDescriptor);
+
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+
+	// Decoders read the file front to back
+	madvise(mapping, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+	data = static_cast<const uint8_t*>(mapping);
+	size = static_cast<size_t>(fileStat.st_size);
+
+	return true;
+}
+
+void FranAudioShared::IO::MappedFile::Close()
+{
+	if (data != nullptr)
+	{
+		munmap(const_cast<uint8_t*>(data), size);
+	}
+
+	data = nullptr;
+	size = 0;
+}
+
+#endif // __linux__
@@ -0,0 +1,78 @@
+// FranticDreamer 2022-2025
+
+#ifdef _WIN32
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+
+#include "MappedFile.hpp"
+
+bool FranAudioShared::IO::MappedFile::Open(const std::string& filename)
+{
+	Close();
+
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize = {};
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	data = static_cast<const uint8_t*>(view);
+	size = static_cast<size_t>(fileSize.QuadPart);
+
+	return true;
+}
+
+void FranAudioShared::IO::MappedFile::Close()
+{
+	if (data != nullptr)
+	{
+		UnmapViewOfFile(data);
+	}
+
+	if (mappingHandle != nullptr)
+	{
+		CloseHandle(mappingHandle);
+	}
+
+	if (fileHandle != nullptr)
+	{
+		CloseHandle(fileHandle);
+	}
+
+	data = nullptr;
+	size = 0;
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+}
+
+#endif // _WIN32
@@ -3,6 +3,7 @@
 
 #include <print>
 #include <format>
+#include <mutex>
 
 #include "Logger.hpp"
 
@@ -10,9 +11,20 @@
 // Logging Functions
 // ========================
 
+namespace
+{
+	/// <summary>
+	/// Serialises log output, since loader threads can log at the same time as the main thread.
+	/// Recursive because some log functions call each other.
+	/// </summary>
+	std::recursive_mutex logMutex;
+}
+
 void FranAudioShared::Logger::LogMessage(const std::string& message, bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << "[INFO] " << message;
@@ -33,6 +45,8 @@ void FranAudioShared::Logger::LogMessage(const std::string& message, bool newLin
 void FranAudioShared::Logger::LogError(const std::string& message, bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << "[ERROR] " << message;
@@ -53,6 +67,8 @@ void FranAudioShared::Logger::LogError(const std::string& message, bool newLine)
 void FranAudioShared::Logger::LogWarning(const std::string& message, bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << "[WARNING] " << message;
@@ -73,6 +89,8 @@ void FranAudioShared::Logger::LogWarning(const std::string& message, bool newLin
 void FranAudioShared::Logger::LogSuccess(const std::string& message, bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << "[SUCCESS] " << message;
@@ -93,6 +111,8 @@ void FranAudioShared::Logger::LogSuccess(const std::string& message, bool newLin
 void FranAudioShared::Logger::LogGeneric(const std::string& message, bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << message;
@@ -113,6 +133,8 @@ void FranAudioShared::Logger::LogGeneric(const std::string& message, bool newLin
 void FranAudioShared::Logger::LogSeperator(bool newLine)
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	// Don't log seperators to custom console for now.
 	// TODO: Implement console messages ordered by time.
 	if (customStreamBuffer != nullptr)
@@ -132,6 +154,8 @@ void FranAudioShared::Logger::LogSeperator(bool newLine)
 void FranAudioShared::Logger::LogNewline()
 {
 #ifndef FRANAUDIO_DISABLE_LOGGING
+	std::lock_guard lock(logMutex);
+
 	if (customStreamBuffer != nullptr)
 	{
 		*customOstream << "\n";
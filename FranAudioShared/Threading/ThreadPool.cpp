@@ -0,0 +1,109 @@
+// FranticDreamer 2022-2025
+
+#include <algorithm>
+
+#include "ThreadPool.hpp"
+
+FranAudioShared::Threading::ThreadPool::~ThreadPool()
+{
+	Stop();
+}
+
+void FranAudioShared::Threading::ThreadPool::Start(size_t threadCount)
+{
+	std::lock_guard lock(tasksMutex);
+	StartWorkers(threadCount);
+}
+
+void FranAudioShared::Threading::ThreadPool::StartWorkers(size_t threadCount)
+{
+	if (!workers.empty())
+	{
+		return;
+	}
+
+	if (threadCount == 0)
+	{
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	stopping = false;
+	workers.reserve(threadCount);
+	for (size_t i = 0; i < threadCount; i++)
+	{
+		workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+}
+
+void FranAudioShared::Threading::ThreadPool::Stop()
+{
+	std::vector<std::thread> stoppingWorkers;
+
+	{
+		std::lock_guard lock(tasksMutex);
+		stopping = true;
+		stoppingWorkers.swap(workers);
+	}
+	tasksCondition.notify_all();
+
+	for (auto& worker : stoppingWorkers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+}
+
+void FranAudioShared::Threading::ThreadPool::Enqueue(std::function<void()> task)
+{
+	{
+		std::lock_guard lock(tasksMutex);
+		StartWorkers(0);
+		tasks.push_back(std::move(task));
+	}
+	tasksCondition.notify_one();
+}
+
+void FranAudioShared::Threading::ThreadPool::WaitIdle()
+{
+	std::unique_lock lock(tasksMutex);
+	idleCondition.wait(lock, [this] { return tasks.empty() && runningTasks == 0; });
+}
+
+size_t FranAudioShared::Threading::ThreadPool::GetThreadCount()
+{
+	std::lock_guard lock(tasksMutex);
+	return workers.size();
+}
+
+void FranAudioShared::Threading::ThreadPool::WorkerLoop()
+{
+	while (true)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock lock(tasksMutex);
+			tasksCondition.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+			// Drain the queue before exiting
+			if (tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(tasks.front());
+			tasks.pop_front();
+			runningTasks++;
+		}
+
+		task();
+
+		{
+			std::lock_guard lock(tasksMutex);
+			runningTasks--;
+		}
+		idleCondition.notify_all();
+	}
+}
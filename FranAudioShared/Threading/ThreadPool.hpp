@@ -0,0 +1,80 @@
+// FranticDreamer 2022-2025
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace FranAudioShared::Threading
+{
+	/// <summary>
+	/// A simple fixed-size worker pool.
+	///
+	/// Tasks are executed in FIFO order by the first free worker.
+	/// This is used for work that shouldn't block the calling thread, like decoding audio files.
+	/// </summary>
+	class ThreadPool
+	{
+	private:
+		std::vector<std::thread> workers;
+
+		std::deque<std::function<void()>> tasks;
+		std::mutex tasksMutex;
+		std::condition_variable tasksCondition;
+		std::condition_variable idleCondition;
+
+		/// <summary>
+		/// Number of tasks that are currently being executed by a worker.
+		/// </summary>
+		size_t runningTasks = 0;
+
+		bool stopping = false;
+
+		void WorkerLoop();
+
+		/// <summary>
+		/// Spawn the workers. tasksMutex must be held.
+		/// </summary>
+		void StartWorkers(size_t threadCount);
+
+	public:
+		ThreadPool() = default;
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		~ThreadPool();
+
+		/// <summary>
+		/// Start the worker threads.
+		/// Does nothing if the pool is already running.
+		/// </summary>
+		/// <param name="threadCount">Number of workers. 0 means one per hardware thread.</param>
+		void Start(size_t threadCount = 0);
+
+		/// <summary>
+		/// Stop the worker threads.
+		/// Tasks that are already queued will be finished before the workers exit.
+		/// </summary>
+		void Stop();
+
+		/// <summary>
+		/// Queue a task to be executed on a worker thread.
+		/// Starts the pool if it's not running yet.
+		/// </summary>
+		/// <param name="task">Task to execute</param>
+		void Enqueue(std::function<void()> task);
+
+		/// <summary>
+		/// Block until every queued and running task is finished.
+		/// </summary>
+		void WaitIdle();
+
+		/// <summary>
+		/// Get the number of worker threads.
+		/// </summary>
+		/// <returns>Number of worker threads, 0 if the pool is not running</returns>
+		size_t GetThreadCount();
+	};
+}
@@ -206,6 +206,10 @@ int main()
 	{
 		glfwPollEvents();
 
+#ifndef FRANAUDIO_USE_SERVER
+		FranAudio::Update();
+#endif
+
 		ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();